@@ -0,0 +1,165 @@
+#include "XRAudioPoolSubsystem.h"
+#include "XRCoreSettings.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "Sound/SoundBase.h"
+
+bool UXRAudioPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Nothing is audible on a dedicated server
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UXRAudioPoolSubsystem::Deinitialize()
+{
+	for (FXRPooledAudioVoice& Voice : Voices)
+	{
+		if (Voice.AudioComponent)
+		{
+			Voice.AudioComponent->Stop();
+			Voice.AudioComponent->DestroyComponent();
+		}
+	}
+	Voices.Empty();
+	Super::Deinitialize();
+}
+
+UXRAudioPoolSubsystem* UXRAudioPoolSubsystem::Get(const UObject* InWorldContextObject)
+{
+	if (!InWorldContextObject)
+	{
+		return nullptr;
+	}
+	UWorld* World = InWorldContextObject->GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+	return World->GetSubsystem<UXRAudioPoolSubsystem>();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Playback
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+FXRAudioHandle UXRAudioPoolSubsystem::PlaySoundAtLocation(USoundBase* InSound, const FVector& InLocation)
+{
+	FXRAudioHandle Handle = {};
+	UWorld* World = GetWorld();
+	// PIE dedicated servers share the process with clients, so ShouldCreateSubsystem alone is not enough
+	if (!InSound || !World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return Handle;
+	}
+	const int32 VoiceIndex = AcquireVoice(InSound);
+	if (VoiceIndex == INDEX_NONE)
+	{
+		return Handle;
+	}
+
+	FXRPooledAudioVoice& Voice = Voices[VoiceIndex];
+	Voice.AudioComponent->Stop();
+	Voice.AudioComponent->SetSound(InSound);
+	Voice.AudioComponent->SetWorldLocation(InLocation);
+	Voice.AudioComponent->Play();
+	Voice.Sound = InSound;
+	Voice.Serial++;
+	Voice.StartTime = World->GetTimeSeconds();
+
+	Handle.VoiceIndex = VoiceIndex;
+	Handle.Serial = Voice.Serial;
+	return Handle;
+}
+
+void UXRAudioPoolSubsystem::StopSound(FXRAudioHandle& InOutHandle)
+{
+	if (Voices.IsValidIndex(InOutHandle.VoiceIndex))
+	{
+		FXRPooledAudioVoice& Voice = Voices[InOutHandle.VoiceIndex];
+		if (Voice.Serial == InOutHandle.Serial && Voice.AudioComponent)
+		{
+			Voice.AudioComponent->Stop();
+		}
+	}
+	InOutHandle.Reset();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Voices
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Steal the oldest voice of the same sound once its limit is reached, otherwise use an idle voice, grow the pool or steal the oldest voice overall
+int32 UXRAudioPoolSubsystem::AcquireVoice(const USoundBase* InSound)
+{
+	const UXRCoreSettings* Settings = GetDefault<UXRCoreSettings>();
+	const int32 MaxVoices = FMath::Max(Settings->AudioPoolSize, 1);
+	const int32 MaxVoicesPerSound = FMath::Max(Settings->MaxVoicesPerSound, 1);
+
+	int32 SameSoundCount = 0;
+	int32 OldestSameSoundIndex = INDEX_NONE;
+	int32 OldestIndex = INDEX_NONE;
+	int32 IdleIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Voices.Num(); Index++)
+	{
+		const FXRPooledAudioVoice& Voice = Voices[Index];
+		if (!Voice.AudioComponent)
+		{
+			continue;
+		}
+		if (!IsVoicePlaying(Voice))
+		{
+			if (IdleIndex == INDEX_NONE)
+			{
+				IdleIndex = Index;
+			}
+			continue;
+		}
+		if (Voice.Sound == InSound)
+		{
+			SameSoundCount++;
+			if (OldestSameSoundIndex == INDEX_NONE || Voice.StartTime < Voices[OldestSameSoundIndex].StartTime)
+			{
+				OldestSameSoundIndex = Index;
+			}
+		}
+		if (OldestIndex == INDEX_NONE || Voice.StartTime < Voices[OldestIndex].StartTime)
+		{
+			OldestIndex = Index;
+		}
+	}
+
+	if (SameSoundCount >= MaxVoicesPerSound)
+	{
+		return OldestSameSoundIndex;
+	}
+	if (IdleIndex != INDEX_NONE)
+	{
+		return IdleIndex;
+	}
+	if (Voices.Num() < MaxVoices)
+	{
+		return CreateVoice();
+	}
+	return OldestIndex;
+}
+
+int32 UXRAudioPoolSubsystem::CreateVoice()
+{
+	UWorld* World = GetWorld();
+	UAudioComponent* AudioComponent = NewObject<UAudioComponent>(World);
+	if (!AudioComponent)
+	{
+		return INDEX_NONE;
+	}
+	AudioComponent->bAutoActivate = false;
+	AudioComponent->bAutoDestroy = false;
+	AudioComponent->bAllowSpatialization = true;
+	AudioComponent->RegisterComponentWithWorld(World);
+
+	FXRPooledAudioVoice& Voice = Voices.AddDefaulted_GetRef();
+	Voice.AudioComponent = AudioComponent;
+	return Voices.Num() - 1;
+}
+
+bool UXRAudioPoolSubsystem::IsVoicePlaying(const FXRPooledAudioVoice& InVoice) const
+{
+	return InVoice.AudioComponent && InVoice.AudioComponent->IsPlaying();
+}
@@ -7,6 +7,7 @@
 #include "XRToolsUtilityFunctions.h"
 #include "XRInteractionGrab.h"
 #include "XRReplicatedPhysicsComponent.h"
+#include "XRCoreSettings.h"
 #include "Net/UnrealNetwork.h"
 
 UXRConnectorComponent::UXRConnectorComponent()
@@ -15,17 +16,7 @@ UXRConnectorComponent::UXRConnectorComponent()
 	PrimaryComponentTick.bStartWithTickEnabled = true;
 	bAutoActivate = true;
 	SetIsReplicatedByDefault(true);
-
-	// Assign default hologram class from settings if not already set.
-	const UXRCoreSettings* DefaultSettings = GetDefault<UXRCoreSettings>();
-	if (DefaultSettings && !HologramClass)
-	{
-		HologramClass = DefaultSettings->DefaultHologramClass.Get();
-	}
-	else
-	{
-		HologramClass = AXRConnectorHologram::StaticClass();
-	}
+	// The default hologram class from XRCoreSettings is resolved when spawning, see GetHologramClass
 }
 
 void UXRConnectorComponent::BeginPlay()
@@ -233,6 +224,7 @@ void UXRConnectorComponent::InternalAttachToSocket()
 	}
 	GetOwner()->AttachToComponent(ConnectedSocket.Get(), FAttachmentTransformRules(EAttachmentRule::SnapToTarget, EAttachmentRule::SnapToTarget, EAttachmentRule::KeepWorld, false));
 	ConnectedSocket.Get()->RegisterConnection(this);
+	OnConnectedNative.Broadcast(this, ConnectedSocket.Get());
 	OnConnected.Broadcast(this, ConnectedSocket.Get());
 	PreviouslyConnectedSocket = ConnectedSocket.Get();
 }
@@ -250,6 +242,7 @@ void UXRConnectorComponent::InternalDetachFromSocket()
 	}
 	GetOwner()->DetachFromActor(FDetachmentTransformRules(EDetachmentRule::KeepWorld, false));
 	PreviouslyConnectedSocket.Get()->DeregisterConnection(this);
+	OnDisconnectedNative.Broadcast(this, PreviouslyConnectedSocket.Get());
 	OnDisconnected.Broadcast(this, PreviouslyConnectedSocket.Get());
 	PreviouslyConnectedSocket = nullptr;
 
@@ -295,6 +288,17 @@ void UXRConnectorComponent::InitializeOverlapBindings()
 	{
 		Collider->OnComponentBeginOverlap.AddDynamic(this, &UXRConnectorComponent::OnOverlapBegin);
 		Collider->OnComponentEndOverlap.AddDynamic(this, &UXRConnectorComponent::OnOverlapEnd);
+
+		// Account for overlaps that began before the bindings existed, so their EndOverlap is reference counted correctly
+		TArray<UPrimitiveComponent*> OverlappedComponents = {};
+		Collider->GetOverlappingComponents(OverlappedComponents);
+		for (UPrimitiveComponent* OverlappedComponent : OverlappedComponents)
+		{
+			if (UXRConnectorSocket* OverlappedSocket = Cast<UXRConnectorSocket>(OverlappedComponent))
+			{
+				SocketOverlapCounts.FindOrAdd(OverlappedSocket)++;
+			}
+		}
 	}
 }
 
@@ -302,6 +306,8 @@ void UXRConnectorComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedCompon
 {
 	if (UXRConnectorSocket* OverlappedSocket = Cast<UXRConnectorSocket>(OtherComp))
 	{
+		int32& OverlapCount = SocketOverlapCounts.FindOrAdd(OverlappedSocket);
+		OverlapCount++;
 		if (!OverlappedSocket->IsConnectionAllowed(this))
 		{
 			return;
@@ -319,21 +325,17 @@ void UXRConnectorComponent::OnOverlapEnd(UPrimitiveComponent* OverlappedComponen
 	if (UXRConnectorSocket* OverlappedSocket = Cast<UXRConnectorSocket>(OtherComp))
 	{
 		// Ensure an overlapped Socket is only removed when no Collider on the OwningActor is overlapping it anymore, not just the one that stopped overlapping
-		for (auto Collider : OwnerCollisions)
+		if (int32* OverlapCount = SocketOverlapCounts.Find(OverlappedSocket))
 		{
-			if (Collider != OverlappedComponent)
+			(*OverlapCount)--;
+			if (*OverlapCount > 0)
 			{
-				TArray<UPrimitiveComponent*> OverlappedComponents = {};
-				Collider->GetOverlappingComponents(OverlappedComponents);
-				if (OverlappedComponents.Contains(OtherComp))
-				{
-					return;
-				}
+				return;
 			}
+			SocketOverlapCounts.Remove(OverlappedSocket);
 		}
 		OverlappedSockets.Remove(OverlappedSocket);
 		HideHologram(OverlappedSocket);
-		UXRConnectorSocket* OutSocket = nullptr;
 	}
 }
 
@@ -383,7 +385,7 @@ void UXRConnectorComponent::ShowHologram(UXRConnectorSocket* InSocket)
 
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	AActor* SpawnedHologram = GetWorld()->SpawnActor<AXRConnectorHologram>(HologramClass, Location, Rotation, SpawnParams);
+	AActor* SpawnedHologram = GetWorld()->SpawnActor<AActor>(GetHologramClass(), Location, Rotation, SpawnParams);
 	if (!SpawnedHologram)
 	{
 		return;
@@ -396,6 +398,19 @@ void UXRConnectorComponent::ShowHologram(UXRConnectorSocket* InSocket)
 	}
 }
 
+TSubclassOf<AActor> UXRConnectorComponent::GetHologramClass() const
+{
+	if (HologramClass)
+	{
+		return HologramClass;
+	}
+	if (UClass* DefaultHologramClass = GetDefault<UXRCoreSettings>()->DefaultHologramClass.Get())
+	{
+		return DefaultHologramClass;
+	}
+	return AXRConnectorHologram::StaticClass();
+}
+
 void UXRConnectorComponent::ShowAllAvailableHolograms()
 {
 	AActor* Owner = GetOwner();
@@ -487,23 +502,18 @@ void UXRConnectorComponent::InitializeInteractionBindings()
 	AActor* Owner = GetOwner();
 	if (!Owner) return;
 
-	TArray<UXRInteractionGrab*> FoundGrabInteractions;
+	TInlineComponentArray<UXRInteractionGrab*> FoundGrabInteractions;
 	Owner->GetComponents<UXRInteractionGrab>(FoundGrabInteractions);
-	TArray<UXRInteractionComponent*> InteractionComponents;
+	TArray<UXRInteractionComponent*, TInlineAllocator<8>> InteractionComponents;
 	for (UXRInteractionGrab* GrabInteraction : FoundGrabInteractions)
 	{
-		// Because UXRInteractionGrab inherits from UXRInteractionComponent, we can safely cast
-		UXRInteractionComponent* InteractionComponent = Cast<UXRInteractionComponent>(GrabInteraction);
-		if (InteractionComponent)
-		{
-			InteractionComponents.Add(InteractionComponent);
-		}
+		InteractionComponents.Add(GrabInteraction);
 	}
-	auto FoundInteractionComp = UXRToolsUtilityFunctions::GetXRInteractionByPriority(InteractionComponents, nullptr, 0, EXRInteractionPrioritySelection::LowerEqual,5);
+	auto FoundInteractionComp = UXRToolsUtilityFunctions::GetXRInteractionByPriority(MakeArrayView(InteractionComponents), nullptr, 0, EXRInteractionPrioritySelection::LowerEqual);
 	if (FoundInteractionComp)
 	{
-		FoundInteractionComp->OnInteractionStarted.AddDynamic(this, &UXRConnectorComponent::OnInteractionStarted);
-		FoundInteractionComp->OnInteractionEnded.AddDynamic(this, &UXRConnectorComponent::OnInteractionEnded);
+		FoundInteractionComp->OnInteractionStartedNative.AddUObject(this, &UXRConnectorComponent::OnInteractionStarted);
+		FoundInteractionComp->OnInteractionEndedNative.AddUObject(this, &UXRConnectorComponent::OnInteractionEnded);
 		BoundGrabComponent = Cast<UXRInteractionGrab>(FoundInteractionComp);
 	}
 }
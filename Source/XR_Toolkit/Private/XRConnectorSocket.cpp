@@ -46,6 +46,7 @@ void UXRConnectorSocket::RegisterConnection(UXRConnectorComponent* InConnectorCo
     {
         SetSocketState(EXRConnectorSocketState::Disabled);
     }
+    OnSocketConnectedNative.Broadcast(this, InConnectorComponent);
     OnSocketConnected.Broadcast(this, InConnectorComponent);
 }
 
@@ -60,6 +61,7 @@ void UXRConnectorSocket::DeregisterConnection(UXRConnectorComponent* InConnector
     {
         SetSocketState(EXRConnectorSocketState::Enabled);
     }
+    OnSocketDisconnectedNative.Broadcast(this, InConnectorComponent);
     OnSocketDisconnected.Broadcast(this, InConnectorComponent);
 }
 
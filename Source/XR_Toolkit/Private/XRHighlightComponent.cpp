@@ -1,48 +1,93 @@
 
 #include "XRHighlightComponent.h"
+#include "XRHighlightSubsystem.h"
 
 UXRHighlightComponent::UXRHighlightComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = false;
+	// Fades are driven by the XRHighlightSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	bAutoActivate = true;
 }
 
 void UXRHighlightComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	InitializeFadeTimeline();
 	SetHighlightIncludeOnlyTags(HighlightIncludeOnlyTags);
 	SetHighlightFadeCurve(HighlightFadeCurve);
 }
 
-void UXRHighlightComponent::TickComponent(float DeltaTime, ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction)
+void UXRHighlightComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	FadeTimeline.TickTimeline(DeltaTime);
+	if (UXRHighlightSubsystem* HighlightSubsystem = UXRHighlightSubsystem::Get(this))
+	{
+		HighlightSubsystem->StopFade(this);
+		HighlightSubsystem->SetHighlightLit(this, false);
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 void UXRHighlightComponent::SetHighlighted(float InHighlightState)
 {
-	HighlightState = InHighlightState;
-
-	if (FadeTimeline.IsPlaying() && InHighlightState == 0.0f)
+	if (InHighlightState == 0.0f)
 	{
-		FadeTimeline.Stop();
+		if (UXRHighlightSubsystem* HighlightSubsystem = UXRHighlightSubsystem::Get(this))
+		{
+			HighlightSubsystem->StopFade(this);
+		}
 	}
+	WriteHighlightState(InHighlightState);
+}
 
+void UXRHighlightComponent::WriteHighlightState(float InHighlightState)
+{
+	HighlightState = InHighlightState;
+	if (UXRHighlightSubsystem* HighlightSubsystem = UXRHighlightSubsystem::Get(this))
+	{
+		HighlightSubsystem->SetHighlightLit(this, InHighlightState != 0.0f);
+	}
+	RefreshOwnerMeshComponents();
 	for (auto* HighlightMeshComponent : HighlightableMeshComponents)
 	{
-		if (HighlightMeshComponent)
+		// Unregistered meshes stay cached, they are written again once registered
+		if (!HighlightMeshComponent || !HighlightMeshComponent->IsRegistered())
+		{
+			continue;
+		}
+		switch (HighlightBackend)
 		{
-			HighlightMeshComponent->SetScalarParameterValueOnMaterials(HighlightMaterialParameter, InHighlightState);
+			case EXRHighlightBackend::CustomPrimitiveData:
+				HighlightMeshComponent->SetCustomPrimitiveDataFloat(HighlightCustomPrimitiveDataIndex, InHighlightState);
+				break;
+			default:
+				HighlightMeshComponent->SetScalarParameterValueOnMaterials(HighlightMaterialParameter, InHighlightState);
+				break;
 		}
 	}
 }
 
+void UXRHighlightComponent::SetHighlightBackend(EXRHighlightBackend InHighlightBackend, int32 InCustomPrimitiveDataIndex)
+{
+	InCustomPrimitiveDataIndex = FMath::Max(InCustomPrimitiveDataIndex, 0);
+	if (HighlightBackend == InHighlightBackend && HighlightCustomPrimitiveDataIndex == InCustomPrimitiveDataIndex)
+	{
+		return;
+	}
+	// Nothing written while unlit - writing 0 through the MaterialParameter backend would create the dynamic materials for nothing
+	const float CurrentHighlightState = HighlightState;
+	if (CurrentHighlightState != 0.0f)
+	{
+		WriteHighlightState(0.0f);
+	}
+	HighlightBackend = InHighlightBackend;
+	HighlightCustomPrimitiveDataIndex = InCustomPrimitiveDataIndex;
+	if (CurrentHighlightState != 0.0f)
+	{
+		WriteHighlightState(CurrentHighlightState);
+	}
+}
+
 void UXRHighlightComponent::FadeXRHighlight(bool bFadeIn)
 {
 	if (!IsActive())
@@ -50,21 +95,10 @@ void UXRHighlightComponent::FadeXRHighlight(bool bFadeIn)
 		SetHighlighted(0.0f);
 		return;
 	}
-	if (HighlightFadeCurve)
+	UXRHighlightSubsystem* HighlightSubsystem = UXRHighlightSubsystem::Get(this);
+	if (HighlightFadeCurve && HighlightSubsystem)
 	{
-		if (!bIsTimelineInitialized)
-		{
-			InitializeFadeTimeline();
-		}
-		SetComponentTickEnabled(true);
-		if (bFadeIn)
-			{
-			FadeTimeline.Play();
-		}
-		else
-		{
-			FadeTimeline.Reverse();
-		}
+		HighlightSubsystem->PlayFade(this, HighlightFadeCurve, bFadeIn);
 	}
 	else
 	{
@@ -81,80 +115,116 @@ void UXRHighlightComponent::FadeXRHighlight(bool bFadeIn)
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-void UXRHighlightComponent::TimelineUpdate(float InTimelineProgress)
-{
-	SetHighlighted(InTimelineProgress);
-}
-
-void UXRHighlightComponent::TimelineFinished()
+void UXRHighlightComponent::SetHighlightFadeCurve(UCurveFloat* InHighlightFadeCurve)
 {
-	SetComponentTickEnabled(false);
+	HighlightFadeCurve = InHighlightFadeCurve;
 }
 
-void UXRHighlightComponent::SetHighlightFadeCurve(UCurveFloat* InHighlightFadeCurve)
+void UXRHighlightComponent::CacheHighlightableMeshComponents()
 {
-	HighlightFadeCurve = InHighlightFadeCurve;
-	if (HighlightFadeCurve)
+	if (!bOwnerMeshComponentsGathered)
 	{
-		FOnTimelineFloat TimelineUpdate;
-		TimelineUpdate.BindUFunction(this, FName("TimelineUpdate"));
+		OwnerMeshComponents.Reset();
+		if (const AActor* ParentActor = GetOwner())
+		{
+			TInlineComponentArray<UMeshComponent*> MeshComponents;
+			ParentActor->GetComponents(MeshComponents);
+			OwnerMeshComponents.Append(MeshComponents.GetData(), MeshComponents.Num());
+			OwnerComponentSetGeneration = GetComponentSetGeneration(ParentActor);
+		}
+		bOwnerMeshComponentsGathered = true;
+	}
 
-		FOnTimelineEventStatic TimelineFinished;
-		FadeTimeline.SetTimelineFinishedFunc(TimelineFinished);
-		FadeTimeline.SetLooping(false);
-		FadeTimeline.AddInterpFloat(HighlightFadeCurve, TimelineUpdate);
+	HighlightableMeshComponents.Reset();
+	for (UMeshComponent* MeshComponent : OwnerMeshComponents)
+	{
+		if (MeshComponent && MatchesIncludeOnlyTags(MeshComponent))
+		{
+			HighlightableMeshComponents.AddUnique(MeshComponent);
+		}
 	}
 }
 
-void UXRHighlightComponent::InitializeFadeTimeline()
+// Hashes the identity of every component, so removing one component and adding another in the same frame changes it as well
+uint32 UXRHighlightComponent::GetComponentSetGeneration(const AActor* InActor)
 {
-	if (HighlightFadeCurve && !bIsTimelineInitialized)
+	uint32 Generation = 0;
+	for (const UActorComponent* Component : InActor->GetComponents())
 	{
-		FOnTimelineFloat TimelineUpdate;
-		TimelineUpdate.BindUFunction(this, FName("TimelineUpdate"));
-
-		FOnTimelineEventStatic TimelineFinished;
-		TimelineFinished.BindUFunction(this, FName("TimelineFinished"));
-
-		FadeTimeline.SetTimelineFinishedFunc(TimelineFinished);
-		FadeTimeline.AddInterpFloat(HighlightFadeCurve, TimelineUpdate);
-
-		bIsTimelineInitialized = true;
+		Generation = HashCombineFast(Generation, GetTypeHash(Component));
 	}
+	return Generation;
 }
 
-void UXRHighlightComponent::CacheHighlightableMeshComponents()
+// Components are only added to / removed from the Owner, so a changed component set or a destroyed cached mesh is the only reason to gather again.
+// Collision and physics state changes leave the cache alone.
+bool UXRHighlightComponent::RefreshOwnerMeshComponents()
 {
 	const AActor* ParentActor = GetOwner();
-	TInlineComponentArray<UMeshComponent*> MeshComponents;
-	ParentActor->GetComponents(MeshComponents);
+	if (!ParentActor || !bOwnerMeshComponentsGathered)
+	{
+		return false;
+	}
+	bool bOwnerComponentsChanged = GetComponentSetGeneration(ParentActor) != OwnerComponentSetGeneration;
+	for (int32 MeshIndex = 0; !bOwnerComponentsChanged && MeshIndex < OwnerMeshComponents.Num(); MeshIndex++)
+	{
+		bOwnerComponentsChanged = !IsValid(OwnerMeshComponents[MeshIndex]);
+	}
+	if (!bOwnerComponentsChanged)
+	{
+		return false;
+	}
+	bOwnerMeshComponentsGathered = false;
+	CacheHighlightableMeshComponents();
+	return true;
+}
 
-	TArray<UMeshComponent*> ValidComponents;
-	for (auto* MeshComponent : MeshComponents)
+bool UXRHighlightComponent::MatchesIncludeOnlyTags(const UMeshComponent* InMeshComponent) const
+{
+	if (IncludeOnlyTagSet.Num() == 0)
 	{
-		if (MeshComponent)
+		return true;
+	}
+	for (const FName& Tag : InMeshComponent->ComponentTags)
+	{
+		if (IncludeOnlyTagSet.Contains(Tag))
 		{
-			if (HighlightIncludeOnlyTags.Num() == 0)
-			{
-				ValidComponents.Add(MeshComponent);
-			}
-
-			// Check for Inlcude Only Tags if applicable
-			else 
-			{
-				for (const FName& Tag : HighlightIncludeOnlyTags)
-				{
-					if (MeshComponent->ComponentHasTag(Tag))
-					{
-						ValidComponents.Add(MeshComponent);
-					}
-				}
-
-			}
+			return true;
+		}
+	}
+	return false;
+}
 
+void UXRHighlightComponent::NotifyMeshComponentAdded(UMeshComponent* InMeshComponent)
+{
+	if (!InMeshComponent || InMeshComponent->GetOwner() != GetOwner() || !bOwnerMeshComponentsGathered)
+	{
+		return;
+	}
+	if (OwnerMeshComponents.Contains(InMeshComponent))
+	{
+		return;
+	}
+	OwnerMeshComponents.Add(InMeshComponent);
+	if (MatchesIncludeOnlyTags(InMeshComponent))
+	{
+		HighlightableMeshComponents.AddUnique(InMeshComponent);
+		// Bring the new mesh up to the current state
+		if (HighlightState != 0.0f)
+		{
+			WriteHighlightState(HighlightState);
 		}
 	}
-	HighlightableMeshComponents = ValidComponents;
+}
+
+void UXRHighlightComponent::NotifyMeshComponentRemoved(UMeshComponent* InMeshComponent)
+{
+	if (!InMeshComponent)
+	{
+		return;
+	}
+	OwnerMeshComponents.RemoveSingleSwap(InMeshComponent);
+	HighlightableMeshComponents.RemoveSingleSwap(InMeshComponent);
 }
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -167,6 +237,13 @@ float UXRHighlightComponent::GetHighlightState()
 void UXRHighlightComponent::SetHighlightIncludeOnlyTags(TArray<FName> InHighlightIncludeOnlyTags)
 {
 	HighlightIncludeOnlyTags = InHighlightIncludeOnlyTags;
+	TSet<FName> NewIncludeOnlyTagSet(HighlightIncludeOnlyTags);
+	// Same tags, the cache is kept up to date by RefreshOwnerMeshComponents
+	if (bOwnerMeshComponentsGathered && NewIncludeOnlyTagSet.Num() == IncludeOnlyTagSet.Num() && NewIncludeOnlyTagSet.Includes(IncludeOnlyTagSet))
+	{
+		return;
+	}
+	IncludeOnlyTagSet = MoveTemp(NewIncludeOnlyTagSet);
 	CacheHighlightableMeshComponents();
 }
 
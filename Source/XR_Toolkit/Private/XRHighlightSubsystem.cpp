@@ -0,0 +1,191 @@
+#include "XRHighlightSubsystem.h"
+#include "XRHighlightComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+
+void UXRHighlightSubsystem::Deinitialize()
+{
+	LitHighlights.Empty();
+	ActiveFades.Empty();
+	CurveLUTs.Empty();
+	CurveLUTIndices.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UXRHighlightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXRHighlightSubsystem, STATGROUP_Tickables);
+}
+
+UXRHighlightSubsystem* UXRHighlightSubsystem::Get(const UObject* InWorldContextObject)
+{
+	if (!InWorldContextObject)
+	{
+		return nullptr;
+	}
+	UWorld* World = InWorldContextObject->GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+	return World->GetSubsystem<UXRHighlightSubsystem>();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Fades
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRHighlightSubsystem::PlayFade(UXRHighlightComponent* InHighlight, UCurveFloat* InFadeCurve, bool bInForward)
+{
+	if (!InHighlight || !InFadeCurve)
+	{
+		return;
+	}
+	const int32 CurveIndex = FindOrBakeCurve(InFadeCurve);
+
+	FActiveFade* Fade = nullptr;
+	if (ActiveFades.IsValidIndex(InHighlight->ActiveFadeIndex))
+	{
+		Fade = &ActiveFades[InHighlight->ActiveFadeIndex];
+	}
+	else
+	{
+		InHighlight->ActiveFadeIndex = ActiveFades.Num();
+		Fade = &ActiveFades.AddDefaulted_GetRef();
+		Fade->Highlight = InHighlight;
+		Fade->Position = InHighlight->FadePosition;
+	}
+	// A changed curve keeps the position, clamped into the new curves range
+	Fade->CurveIndex = CurveIndex;
+	Fade->Position = FMath::Clamp(Fade->Position, CurveLUTs[CurveIndex].MinTime, CurveLUTs[CurveIndex].MaxTime);
+	Fade->Direction = bInForward ? 1.0f : -1.0f;
+}
+
+void UXRHighlightSubsystem::StopFade(UXRHighlightComponent* InHighlight)
+{
+	if (InHighlight && ActiveFades.IsValidIndex(InHighlight->ActiveFadeIndex))
+	{
+		RemoveFadeAt(InHighlight->ActiveFadeIndex);
+	}
+}
+
+void UXRHighlightSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	RefreshLitHighlights();
+
+	// Backwards, finished fades are swapped out
+	for (int32 FadeIndex = ActiveFades.Num() - 1; FadeIndex >= 0; FadeIndex--)
+	{
+		FActiveFade& Fade = ActiveFades[FadeIndex];
+		UXRHighlightComponent* Highlight = Fade.Highlight.Get();
+		if (!Highlight)
+		{
+			RemoveFadeAt(FadeIndex);
+			continue;
+		}
+
+		const FCurveLUT& CurveLUT = CurveLUTs[Fade.CurveIndex];
+		Fade.Position = FMath::Clamp(Fade.Position + Fade.Direction * DeltaTime, CurveLUT.MinTime, CurveLUT.MaxTime);
+
+		const float Value = CurveLUT.Sample(Fade.Position);
+		const int32 QuantizedValue = FMath::RoundToInt(Value * FadeQuantizationSteps);
+		if (QuantizedValue != Fade.LastQuantizedValue)
+		{
+			Fade.LastQuantizedValue = QuantizedValue;
+			Highlight->WriteHighlightState(Value);
+		}
+
+		const bool bFinished = Fade.Direction > 0.0f ? Fade.Position >= CurveLUT.MaxTime : Fade.Position <= CurveLUT.MinTime;
+		if (bFinished)
+		{
+			RemoveFadeAt(FadeIndex);
+		}
+	}
+}
+
+void UXRHighlightSubsystem::RemoveFadeAt(int32 InFadeIndex)
+{
+	if (UXRHighlightComponent* Highlight = ActiveFades[InFadeIndex].Highlight.Get())
+	{
+		Highlight->FadePosition = ActiveFades[InFadeIndex].Position;
+		Highlight->ActiveFadeIndex = INDEX_NONE;
+	}
+	ActiveFades.RemoveAtSwap(InFadeIndex);
+	// Fix up the index of the fade that was swapped into the removed slot
+	if (ActiveFades.IsValidIndex(InFadeIndex))
+	{
+		if (UXRHighlightComponent* SwappedHighlight = ActiveFades[InFadeIndex].Highlight.Get())
+		{
+			SwappedHighlight->ActiveFadeIndex = InFadeIndex;
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Mesh Tracking
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRHighlightSubsystem::SetHighlightLit(UXRHighlightComponent* InHighlight, bool bInLit)
+{
+	if (!InHighlight)
+	{
+		return;
+	}
+	if (bInLit)
+	{
+		LitHighlights.AddUnique(InHighlight);
+	}
+	else
+	{
+		LitHighlights.RemoveSingleSwap(InHighlight);
+	}
+}
+
+// Only lit Highlights need meshes added at runtime right away, all others pick them up with their next state write
+void UXRHighlightSubsystem::RefreshLitHighlights()
+{
+	for (int32 HighlightIndex = LitHighlights.Num() - 1; HighlightIndex >= 0; HighlightIndex--)
+	{
+		UXRHighlightComponent* Highlight = LitHighlights[HighlightIndex].Get();
+		if (!Highlight)
+		{
+			LitHighlights.RemoveAtSwap(HighlightIndex);
+			continue;
+		}
+		if (Highlight->RefreshOwnerMeshComponents())
+		{
+			Highlight->WriteHighlightState(Highlight->HighlightState);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Curves
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+int32 UXRHighlightSubsystem::FindOrBakeCurve(UCurveFloat* InFadeCurve)
+{
+	if (const int32* ExistingIndex = CurveLUTIndices.Find(InFadeCurve))
+	{
+		return *ExistingIndex;
+	}
+	FCurveLUT& CurveLUT = CurveLUTs.AddDefaulted_GetRef();
+	InFadeCurve->GetTimeRange(CurveLUT.MinTime, CurveLUT.MaxTime);
+	CurveLUT.MaxTime = FMath::Max(CurveLUT.MaxTime, CurveLUT.MinTime);
+	for (int32 SampleIndex = 0; SampleIndex < CurveLUTSamples; SampleIndex++)
+	{
+		const float Alpha = static_cast<float>(SampleIndex) / (CurveLUTSamples - 1);
+		CurveLUT.Samples[SampleIndex] = InFadeCurve->GetFloatValue(FMath::Lerp(CurveLUT.MinTime, CurveLUT.MaxTime, Alpha));
+	}
+	return CurveLUTIndices.Add(InFadeCurve, CurveLUTs.Num() - 1);
+}
+
+float UXRHighlightSubsystem::FCurveLUT::Sample(float InTime) const
+{
+	const float Range = MaxTime - MinTime;
+	if (Range <= KINDA_SMALL_NUMBER)
+	{
+		return Samples[CurveLUTSamples - 1];
+	}
+	const float SamplePosition = FMath::Clamp((InTime - MinTime) / Range, 0.0f, 1.0f) * (CurveLUTSamples - 1);
+	const int32 LowerIndex = FMath::Min(FMath::FloorToInt(SamplePosition), CurveLUTSamples - 2);
+	return FMath::Lerp(Samples[LowerIndex], Samples[LowerIndex + 1], SamplePosition - LowerIndex);
+}
@@ -2,9 +2,16 @@
 #include "XRInteractionComponent.h"
 #include "XRInteractorComponent.h"
 #include "XRHighlightComponent.h"
-#include "Components/AudioComponent.h"
+#include "XRInteractionSubsystem.h"
+#include "XRInteractionProfile.h"
+#include "XRCoreSettings.h"
+#include "XRToolsUtilityFunctions.h"
+#include "XR_Toolkit.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
 #include "GameFramework/GameSession.h"
-#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 UXRInteractionComponent::UXRInteractionComponent()
@@ -13,52 +20,121 @@ UXRInteractionComponent::UXRInteractionComponent()
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 	bAutoActivate = true;
 	SetIsReplicatedByDefault(true);
+	// Sound and curve defaults from XRCoreSettings are resolved on use, see FXR_ToolkitModule::PreloadDefaultAssets
+}
 
-	// Assign default hologram class from settings if not already set.
-	const UXRCoreSettings* DefaultSettings = GetDefault<UXRCoreSettings>();
-	if (DefaultSettings)
+void UXRInteractionComponent::OnRegister()
+{
+	Super::OnRegister();
+	// Captured before any replicated detachment can reach clients, the anchor is needed for the registration below
+	if (SpatialMode == EXRInteractionSpatialMode::Detached && GetWorld() && GetWorld()->IsGameWorld())
 	{
-		if (!InteractionStartSound)
-		{
-			InteractionStartSound = DefaultSettings->DefaultInteractionStartSound.Get();
-		}
-		if (!InteractionEndSound)
-		{
-			InteractionEndSound = DefaultSettings->DefaultInteractionEndSound.Get();
-		}
-		if (!HighlightFadeCurve)
+		CaptureAnchor();
+	}
+	RegisterWithSubsystem();
+}
+
+void UXRInteractionComponent::OnAttachmentChanged()
+{
+	Super::OnAttachmentChanged();
+	// The registry maps the parents of the Interaction, which just changed
+	if (IsRegistered())
+	{
+		RegisterWithSubsystem();
+	}
+}
+
+void UXRInteractionComponent::RegisterWithSubsystem()
+{
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		InteractionSubsystem->RegisterInteraction(this);
+		if (InteractionProxy)
 		{
-			HighlightFadeCurve = DefaultSettings->DefaultHighlightFadeCurve.Get();
+			InteractionSubsystem->RegisterInteractionProxy(this, InteractionProxy);
 		}
 	}
 }
 
+void UXRInteractionComponent::OnUnregister()
+{
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		InteractionSubsystem->UnregisterInteraction(this);
+	}
+	Super::OnUnregister();
+}
+
 void UXRInteractionComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
-	GetOwner()->SetReplicates(true);
+	if (RequiresReplicatedOwner())
+	{
+		GetOwner()->SetReplicates(true);
+	}
 	UpdateAbsolouteInteractionPriority();
 }
 
+bool UXRInteractionComponent::RequiresReplicatedOwner() const
+{
+	return bReplicateOwner;
+}
+
 void UXRInteractionComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	if (bEnableHighlighting)
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		InteractionHandle = InteractionSubsystem->AcquireInteractionHandle(this);
+	}
+	// Actors attached after OnRegister (iE. ChildActors) are only known by now
+	RegisterWithSubsystem();
+	if (SpatialMode == EXRInteractionSpatialMode::Detached)
+	{
+		DetachFromAnchor();
+	}
+	SpawnInteractionProxy();
+	if (bEnableHighlighting && HighlightCreation == EXRHighlightCreation::OnBeginPlay)
 	{
 		SpawnAndConfigureXRHighlight();
 	}
 }
 
+void UXRInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// XRInteractors only hold this Interactions handle, leave them with an exact hover state
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		for (const FXRInteractorHandle& Hovering : HoveringInteractorHandles)
+		{
+			if (UXRInteractorComponent* HoveringInteractor = InteractionSubsystem->ResolveInteractor(Hovering))
+			{
+				HoveringInteractor->RemoveHoveredInteraction(InteractionHandle);
+			}
+		}
+		InteractionSubsystem->ReleaseInteractionHandle(InteractionHandle);
+	}
+	HoveringInteractorHandles.Reset();
+	InteractionHandle.Reset();
+	DestroyInteractionProxy();
+	Super::EndPlay(EndPlayReason);
+}
+
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 // Interaction Events
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UXRInteractionComponent::StartInteraction(UXRInteractorComponent* InInteractor)
 {
-	ActiveInteractors.AddUnique(TWeakObjectPtr<UXRInteractorComponent>(InInteractor));
-	HoveringInteractors.Remove(TWeakObjectPtr<UXRInteractorComponent>(InInteractor));
+	SyncToAnchor();
+	if (InInteractor && InInteractor->GetInteractorHandle().IsValid())
+	{
+		ActiveInteractorHandles.AddUnique(InInteractor->GetInteractorHandle());
+		HoveringInteractorHandles.Remove(InInteractor->GetInteractorHandle());
+	}
 	OnInteractionStart(InInteractor);
+	OnInteractionStartedNative.Broadcast(this, InInteractor);
 	OnInteractionStarted.Broadcast(this, InInteractor);
-	RequestAudioPlay(InteractionStartSound);
+	RequestAudioPlay(GetInteractionStartSound());
 	if (XRHighlightComponent)
 	{
 		XRHighlightComponent->SetHighlighted(0.0f);
@@ -67,42 +143,71 @@ void UXRInteractionComponent::StartInteraction(UXRInteractorComponent* InInterac
 
 void UXRInteractionComponent::EndInteraction(UXRInteractorComponent* InInteractor)
 {
-	ActiveInteractors.Remove(TWeakObjectPtr<UXRInteractorComponent>(InInteractor));
+	if (InInteractor)
+	{
+		ActiveInteractorHandles.Remove(InInteractor->GetInteractorHandle());
+	}
+	OnInteractionEndedNative.Broadcast(this, InInteractor);
+	OnInteractionEnded.Broadcast(this, InInteractor);
+	RequestAudioPlay(GetInteractionEndSound());
+}
+
+void UXRInteractionComponent::RollbackInteraction(UXRInteractorComponent* InInteractor)
+{
+	if (InInteractor)
+	{
+		ActiveInteractorHandles.Remove(InInteractor->GetInteractorHandle());
+	}
+	if (UXRAudioPoolSubsystem* AudioPool = UXRAudioPoolSubsystem::Get(this))
+	{
+		AudioPool->StopSound(CurrentAudioHandle);
+	}
+	OnInteractionEnd(InInteractor);
+	OnInteractionEndedNative.Broadcast(this, InInteractor);
 	OnInteractionEnded.Broadcast(this, InInteractor);
-	RequestAudioPlay(InteractionEndSound);
 }
 
 void UXRInteractionComponent::HoverInteraction(UXRInteractorComponent* InInteractor, bool bInHoverState)
 {
-	if (!InInteractor)
+	if (!InInteractor || !InInteractor->GetInteractorHandle().IsValid())
 	{
 		return;
 	}
 	if (bInHoverState)
 	{	
-		TArray<UXRInteractorComponent*> CurrentHoveringInteractors = {};
-		if (!IsHovered(CurrentHoveringInteractors))
+		if (HoveringInteractorHandles.Num() == 0)
 		{
+			SyncToAnchor();
+			if (bEnableHighlighting && HighlightCreation == EXRHighlightCreation::OnFirstHover)
+			{
+				GetWorld()->GetTimerManager().ClearTimer(HighlightReleaseTimer);
+				SpawnAndConfigureXRHighlight();
+			}
 			OnInteractionHover(true, InInteractor);
+			OnInteractionHoveredNative.Broadcast(this, InInteractor, true);
 			OnInteractionHovered.Broadcast(this, InInteractor, true);
 			if (XRHighlightComponent)
 			{
 				XRHighlightComponent->FadeXRHighlight(true);
 			}
 		}
-		HoveringInteractors.AddUnique(TWeakObjectPtr<UXRInteractorComponent>(InInteractor));
+		HoveringInteractorHandles.AddUnique(InInteractor->GetInteractorHandle());
 	}
 	if (!bInHoverState)
 	{
-		HoveringInteractors.Remove(TWeakObjectPtr<UXRInteractorComponent>(InInteractor));
-		TArray<UXRInteractorComponent*> CurrentHoveringInteractors = {};
-		if (!IsHovered(CurrentHoveringInteractors))
+		HoveringInteractorHandles.Remove(InInteractor->GetInteractorHandle());
+		if (HoveringInteractorHandles.Num() == 0)
 		{
 			OnInteractionHover(false, InInteractor);
+			OnInteractionHoveredNative.Broadcast(this, InInteractor, false);
 			OnInteractionHovered.Broadcast(this, InInteractor, false);
 			if (XRHighlightComponent)
 			{
 				XRHighlightComponent->FadeXRHighlight(false);
+				if (HighlightCreation == EXRHighlightCreation::OnFirstHover && HighlightIdleReleaseTime > 0.0f)
+				{
+					GetWorld()->GetTimerManager().SetTimer(HighlightReleaseTimer, this, &UXRInteractionComponent::ReleaseXRHighlight, HighlightIdleReleaseTime, false);
+				}
 			}
 		}
 	}
@@ -111,17 +216,83 @@ void UXRInteractionComponent::HoverInteraction(UXRInteractorComponent* InInterac
 
 bool UXRInteractionComponent::IsHovered(TArray<UXRInteractorComponent*>& OutHoveringInteractors)
 {
-	for (auto HoveringInteractor : HoveringInteractors)
+	if (const UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
 	{
-		UXRInteractorComponent* ValidInteractor = HoveringInteractor.Get();
-		if (ValidInteractor)
+		for (const FXRInteractorHandle& HoveringInteractor : HoveringInteractorHandles)
 		{
-			OutHoveringInteractors.Add(ValidInteractor);
+			if (UXRInteractorComponent* ValidInteractor = InteractionSubsystem->ResolveInteractor(HoveringInteractor))
+			{
+				OutHoveringInteractors.Add(ValidInteractor);
+			}
 		}
 	}
 	return OutHoveringInteractors.Num() > 0;
 }
 
+int32 UXRInteractionComponent::GetHoveringInteractorCount() const
+{
+	return HoveringInteractorHandles.Num();
+}
+
+void UXRInteractionComponent::RemoveInteractor(const FXRInteractorHandle& InInteractorHandle)
+{
+	ActiveInteractorHandles.Remove(InInteractorHandle);
+	HoveringInteractorHandles.Remove(InInteractorHandle);
+}
+
+FXRInteractionHandle UXRInteractionComponent::GetInteractionHandle() const
+{
+	return InteractionHandle;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Profile
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+UXRInteractionProfile* UXRInteractionComponent::GetInteractionProfile() const
+{
+	return InteractionProfile;
+}
+
+void UXRInteractionComponent::SetInteractionProfile(UXRInteractionProfile* InInteractionProfile)
+{
+	InteractionProfile = InInteractionProfile;
+	UpdateAbsolouteInteractionPriority();
+	if (XRHighlightComponent)
+	{
+		XRHighlightComponent->SetHighlightFadeCurve(GetHighlightFadeCurve());
+		XRHighlightComponent->SetHighlightIncludeOnlyTags(GetHighlightIncludeOnlyTags());
+	}
+}
+
+bool UXRInteractionComponent::UsesProfileValue(EXRInteractionProfileOverride InSetting) const
+{
+	return InteractionProfile && (ProfileOverrides & static_cast<int32>(InSetting)) == 0;
+}
+
+const TArray<FName>& UXRInteractionComponent::GetHighlightIncludeOnlyTags() const
+{
+	return UsesProfileValue(EXRInteractionProfileOverride::HighlightIncludeOnlyTags) ? InteractionProfile->HighlightIncludeOnlyTags : HighlightIncludeOnlyTags;
+}
+
+// Unset values fall back to the preloaded XRCoreSettings defaults, which are nullptr while the preload is still running
+UCurveFloat* UXRInteractionComponent::GetHighlightFadeCurve() const
+{
+	UCurveFloat* FadeCurve = UsesProfileValue(EXRInteractionProfileOverride::HighlightFadeCurve) ? InteractionProfile->HighlightFadeCurve : HighlightFadeCurve;
+	return FadeCurve ? FadeCurve : GetDefault<UXRCoreSettings>()->DefaultHighlightFadeCurve.Get();
+}
+
+USoundBase* UXRInteractionComponent::GetInteractionStartSound() const
+{
+	USoundBase* Sound = UsesProfileValue(EXRInteractionProfileOverride::InteractionStartSound) ? InteractionProfile->InteractionStartSound : InteractionStartSound;
+	return Sound || !bUseDefaultSounds ? Sound : GetDefault<UXRCoreSettings>()->DefaultInteractionStartSound.Get();
+}
+
+USoundBase* UXRInteractionComponent::GetInteractionEndSound() const
+{
+	USoundBase* Sound = UsesProfileValue(EXRInteractionProfileOverride::InteractionEndSound) ? InteractionProfile->InteractionEndSound : InteractionEndSound;
+	return Sound || !bUseDefaultSounds ? Sound : GetDefault<UXRCoreSettings>()->DefaultInteractionEndSound.Get();
+}
+
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 // Highlighting & Audio
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -135,10 +306,35 @@ void UXRInteractionComponent::SpawnAndConfigureXRHighlight()
 	if (XRHighlightComponent)
 	{
 		XRHighlightComponent->RegisterComponent();
-		XRHighlightComponent->SetHighlightFadeCurve(HighlightFadeCurve);
-		XRHighlightComponent->SetHighlightIncludeOnlyTags(HighlightIncludeOnlyTags);
+		XRHighlightComponent->SetHighlightFadeCurve(GetHighlightFadeCurve());
+		XRHighlightComponent->SetHighlightBackend(HighlightBackend, HighlightCustomPrimitiveDataIndex);
+		XRHighlightComponent->SetHighlightIncludeOnlyTags(GetHighlightIncludeOnlyTags());
 		XRHighlightComponent->Activate();
+
+		// Interactions spawned before the default curve finished loading pick it up afterwards
+		FXR_ToolkitModule& ToolkitModule = FXR_ToolkitModule::Get();
+		if (!ToolkitModule.AreDefaultAssetsLoaded())
+		{
+			ToolkitModule.CallWhenDefaultAssetsLoaded(FSimpleDelegate::CreateWeakLambda(this, [this]()
+			{
+				if (XRHighlightComponent)
+				{
+					XRHighlightComponent->SetHighlightFadeCurve(GetHighlightFadeCurve());
+				}
+			}));
+		}
+	}
+}
+
+void UXRInteractionComponent::ReleaseXRHighlight()
+{
+	if (!XRHighlightComponent || HoveringInteractorHandles.Num() > 0)
+	{
+		return;
 	}
+	XRHighlightComponent->SetHighlighted(0.0f);
+	XRHighlightComponent->DestroyComponent();
+	XRHighlightComponent = nullptr;
 }
 
 UXRHighlightComponent* UXRInteractionComponent::GetXRHighlightComponent()
@@ -146,21 +342,150 @@ UXRHighlightComponent* UXRInteractionComponent::GetXRHighlightComponent()
 	return XRHighlightComponent;
 }
 
+void UXRInteractionComponent::SpawnInteractionProxy()
+{
+	if (InteractionProxy || ProxyShape == EXRInteractionProxyShape::None)
+	{
+		return;
+	}
+	// On an engine channel the proxy would overlap (and be queried by) regular geometry
+	if (!UXRToolsUtilityFunctions::IsProjectCollisionChannel(ProxyCollisionChannel))
+	{
+		UE_LOG(LogXRToolkit, Warning, TEXT("%s: ProxyCollisionChannel has to be a project collision channel, no interaction proxy spawned."), *GetPathName());
+		return;
+	}
+	switch (ProxyShape)
+	{
+		case EXRInteractionProxyShape::Sphere:
+		{
+			USphereComponent* Sphere = NewObject<USphereComponent>(this->GetOwner());
+			Sphere->InitSphereRadius(ProxyExtent.X);
+			InteractionProxy = Sphere;
+			break;
+		}
+		case EXRInteractionProxyShape::Capsule:
+		{
+			UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(this->GetOwner());
+			Capsule->InitCapsuleSize(ProxyExtent.X, ProxyExtent.Z);
+			InteractionProxy = Capsule;
+			break;
+		}
+		case EXRInteractionProxyShape::Box:
+		{
+			UBoxComponent* Box = NewObject<UBoxComponent>(this->GetOwner());
+			Box->InitBoxExtent(ProxyExtent);
+			InteractionProxy = Box;
+			break;
+		}
+		default:
+			return;
+	}
+
+	// Query-only and overlapping nothing but the proxy channel, so the proxy never affects physics or other queries
+	if (AnchorComponent.IsValid())
+	{
+		InteractionProxy->SetupAttachment(AnchorComponent.Get(), AnchorSocket);
+		InteractionProxy->SetRelativeTransform(AnchorOffset);
+	}
+	else
+	{
+		InteractionProxy->SetupAttachment(this);
+	}
+	InteractionProxy->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	InteractionProxy->SetCollisionObjectType(ProxyCollisionChannel);
+	InteractionProxy->SetCollisionResponseToAllChannels(ECR_Ignore);
+	InteractionProxy->SetCollisionResponseToChannel(ProxyCollisionChannel, ECR_Overlap);
+	InteractionProxy->SetGenerateOverlapEvents(true);
+	InteractionProxy->SetCanEverAffectNavigation(false);
+	InteractionProxy->RegisterComponent();
+
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		InteractionSubsystem->RegisterInteractionProxy(this, InteractionProxy);
+	}
+}
+
+void UXRInteractionComponent::DestroyInteractionProxy()
+{
+	if (!InteractionProxy)
+	{
+		return;
+	}
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		InteractionSubsystem->UnregisterInteractionProxy(this, InteractionProxy);
+	}
+	InteractionProxy->DestroyComponent();
+	InteractionProxy = nullptr;
+}
 
-void UXRInteractionComponent::RequestAudioPlay(USoundBase* InSound)
+UPrimitiveComponent* UXRInteractionComponent::GetInteractionProxy() const
+{
+	return InteractionProxy;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Spatial
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRInteractionComponent::CaptureAnchor()
+{
+	USceneComponent* Parent = GetAttachParent();
+	// The root has no parent to follow
+	if (!Parent || AnchorComponent.IsValid())
+	{
+		return;
+	}
+	AnchorComponent = Parent;
+	AnchorOffset = GetComponentTransform().GetRelativeTransform(Parent->GetSocketTransform(AnchorSocket));
+}
+
+void UXRInteractionComponent::DetachFromAnchor()
+{
+	CaptureAnchor();
+	// Registered with the subsystem by its anchor, so lookups are unaffected by leaving the hierarchy
+	if (AnchorComponent.IsValid() && GetAttachParent())
+	{
+		DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+}
+
+// Detached Interactions keep the pose they had at BeginPlay. Content reading the world transform on hover / start (iE. the laser snap) gets the current pose,
+// without the Interaction following the Actor every frame.
+void UXRInteractionComponent::SyncToAnchor()
+{
+	if (AnchorComponent.IsValid() && !GetAttachParent())
+	{
+		SetWorldTransform(AnchorOffset * AnchorComponent->GetSocketTransform(AnchorSocket));
+	}
+}
+
+USceneComponent* UXRInteractionComponent::GetInteractionAnchor() const
+{
+	return AnchorComponent.IsValid() ? AnchorComponent.Get() : GetAttachParent();
+}
+
+FVector UXRInteractionComponent::GetInteractionLocation() const
 {
-	if (CurrentAudioComponent && CurrentAudioComponent->IsPlaying())
+	if (AnchorComponent.IsValid())
 	{
-		CurrentAudioComponent->Stop();
+		return AnchorComponent->GetSocketTransform(AnchorSocket).TransformPosition(AnchorOffset.GetLocation());
 	}
+	return GetComponentLocation();
+}
+
 
+void UXRInteractionComponent::RequestAudioPlay(USoundBase* InSound)
+{
+	// No pool on dedicated servers
+	UXRAudioPoolSubsystem* AudioPool = UXRAudioPoolSubsystem::Get(this);
+	if (!AudioPool)
+	{
+		return;
+	}
+	AudioPool->StopSound(CurrentAudioHandle);
 	if (InSound)
 	{
-		CurrentAudioComponent = UGameplayStatics::SpawnSoundAtLocation(
-			GetWorld(),
-			InSound,
-			this->GetComponentLocation()
-		);
+		CurrentAudioHandle = AudioPool->PlaySoundAtLocation(InSound, GetInteractionLocation());
 	}
 }
 
@@ -169,69 +494,86 @@ void UXRInteractionComponent::RequestAudioPlay(USoundBase* InSound)
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 int32 UXRInteractionComponent::GetInteractionPriority()
 {
-	return AbsolouteInteractionPriority;
+	return ResolvedInteractionPriority;
 }
 void UXRInteractionComponent::UpdateAbsolouteInteractionPriority()
 {
-	int32 OutInteractionPriority = 0;
-	switch (InteractionPriority)
+	// Cached, XRInteractors read the priority for every candidate. AbsolouteInteractionPriority keeps the instance value for when the profile changes.
+	if (UsesProfileValue(EXRInteractionProfileOverride::InteractionPriority))
 	{
-		case EXRInteractionPriority::Primary:
-			OutInteractionPriority = 1;
-			break;
-		case EXRInteractionPriority::Secondary:
-			OutInteractionPriority = 2;
-			break;
-		case EXRInteractionPriority::Custom:
-			OutInteractionPriority = AbsolouteInteractionPriority;
-			break;
+		ResolvedInteractionPriority = UXRInteractionProfile::ResolveInteractionPriority(InteractionProfile->InteractionPriority, InteractionProfile->AbsolouteInteractionPriority);
+		return;
 	}
-	AbsolouteInteractionPriority = OutInteractionPriority;
+	ResolvedInteractionPriority = UXRInteractionProfile::ResolveInteractionPriority(InteractionPriority, AbsolouteInteractionPriority);
 }
 
 TArray<UXRInteractorComponent*> UXRInteractionComponent::GetActiveInteractors() const
 {
 	TArray<UXRInteractorComponent*> OutInteractors = {};
-	for (auto Interactor : ActiveInteractors)
+	if (const UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
 	{
-		if (Interactor.IsValid())
+		for (const FXRInteractorHandle& Interactor : ActiveInteractorHandles)
 		{
-			OutInteractors.AddUnique(Interactor.Get());
+			if (UXRInteractorComponent* ValidInteractor = InteractionSubsystem->ResolveInteractor(Interactor))
+			{
+				OutInteractors.Add(ValidInteractor);
+			}
 		}
 	}
 	return OutInteractors;
 }
 
+int32 UXRInteractionComponent::GetActiveInteractorCount() const
+{
+	return ActiveInteractorHandles.Num();
+}
+
 
 EXRMultiInteractorBehavior UXRInteractionComponent::GetMultiInteractorBehavior() const
 {
+	if (UsesProfileValue(EXRInteractionProfileOverride::MultiInteractorBehavior))
+	{
+		return InteractionProfile->MultiInteractorBehavior;
+	}
 	return MultiInteractorBehavior;
 }
 
 
+bool UXRInteractionComponent::HasActiveInteractor(const UXRInteractorComponent* InInteractor) const
+{
+	return InInteractor && ActiveInteractorHandles.Contains(InInteractor->GetInteractorHandle());
+}
+
 bool UXRInteractionComponent::IsInteractedWith() const
 {
-	return GetActiveInteractors().Num() > 0;
+	return ActiveInteractorHandles.Num() > 0;
 }
 
 EXRLaserBehavior UXRInteractionComponent::GetLaserBehavior() const
 {
+	if (UsesProfileValue(EXRInteractionProfileOverride::LaserBehavior))
+	{
+		return InteractionProfile->LaserBehavior;
+	}
 	return LaserBehavior;
 }
 
 
 void UXRInteractionComponent::SetLaserBehavior(EXRLaserBehavior InLaserBehavior)
 {
+	// Runtime changes apply to this Interaction only
 	LaserBehavior = InLaserBehavior;
+	ProfileOverrides |= static_cast<int32>(EXRInteractionProfileOverride::LaserBehavior);
 }
 
 bool UXRInteractionComponent::IsLaserInteractionEnabled() const
 {
-	if (LaserBehavior == EXRLaserBehavior::Disabled)
+	const EXRLaserBehavior CurrentLaserBehavior = GetLaserBehavior();
+	if (CurrentLaserBehavior == EXRLaserBehavior::Disabled)
 	{
 		return false;
 	}
-	if (LaserBehavior == EXRLaserBehavior::Supress && IsInteractedWith())
+	if (CurrentLaserBehavior == EXRLaserBehavior::Supress && IsInteractedWith())
 	{
 		return false;
 	}
@@ -1,6 +1,7 @@
 #include "XRInteractionGrab.h"
 #include "XRReplicatedPhysicsComponent.h"
 #include "XRInteractorComponent.h"
+#include "XRInteractionSubsystem.h"
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
 #include "Net/UnrealNetwork.h"
 
@@ -67,6 +68,20 @@ void UXRInteractionGrab::EndInteraction(UXRInteractorComponent* InInteractor)
 	}
 }
 
+void UXRInteractionGrab::RollbackInteraction(UXRInteractorComponent* InInteractor)
+{
+    Super::RollbackInteraction(InInteractor);
+    // Release the predicted grab, the authoritative transform replicates back from the server
+    if (bEnablePhysics)
+    {
+        PhysicsUngrab(InInteractor);
+    }
+    else
+    {
+        DetachOwningActorFromXRInteractor();
+    }
+}
+
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 // Grab functions
@@ -78,6 +93,10 @@ void UXRInteractionGrab::AttachOwningActorToXRInteractor(UXRInteractorComponent*
 	{
 		FAttachmentTransformRules Rules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false);
 		GetOwner()->AttachToComponent(InInteractor, Rules);
+		if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+		{
+			InteractionSubsystem->RefreshActorInteractions(GetOwner());
+		}
 	}
 }
 
@@ -85,6 +104,10 @@ void UXRInteractionGrab::DetachOwningActorFromXRInteractor()
 {
 	FDetachmentTransformRules Rules(EDetachmentRule::KeepWorld, EDetachmentRule::KeepWorld, EDetachmentRule::KeepWorld, false);
 	GetOwner()->DetachFromActor(Rules);
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		InteractionSubsystem->RefreshActorInteractions(GetOwner());
+	}
 }
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -96,11 +119,16 @@ bool UXRInteractionGrab::HasPhysicsEnabled() const
 	return bEnablePhysics;
 }
 
+bool UXRInteractionGrab::RequiresReplicatedOwner() const
+{
+	return Super::RequiresReplicatedOwner() || !bEnablePhysics;
+}
+
 void UXRInteractionGrab::PhysicsGrab(UXRInteractorComponent* InInteractor)
 {
 	if (InInteractor)
 	{
-		if (GetOwner()->HasAuthority())
+		if (XRReplicatedPhysicsComponent->HasPhysicsAuthority())
 		{
 			XRReplicatedPhysicsComponent->SetInteractedWith(true);
 		}
@@ -129,7 +157,7 @@ void UXRInteractionGrab::PhysicsUngrab(UXRInteractorComponent* InInteractor)
 			ActivePhysicsConstraint->BreakConstraint();
 		}
 	}
-	if (GetOwner()->HasAuthority() && !IsInteractedWith())
+	if (XRReplicatedPhysicsComponent && XRReplicatedPhysicsComponent->HasPhysicsAuthority() && !IsInteractedWith())
 	{
 		XRReplicatedPhysicsComponent->SetInteractedWith(false);
 	}
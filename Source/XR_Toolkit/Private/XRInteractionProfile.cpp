@@ -0,0 +1,20 @@
+#include "XRInteractionProfile.h"
+
+int32 UXRInteractionProfile::ResolveInteractionPriority(EXRInteractionPriority InInteractionPriority, int32 InAbsolouteInteractionPriority)
+{
+	switch (InInteractionPriority)
+	{
+		case EXRInteractionPriority::Primary:
+			return 1;
+		case EXRInteractionPriority::Secondary:
+			return 2;
+		case EXRInteractionPriority::Custom:
+			return InAbsolouteInteractionPriority;
+	}
+	return 0;
+}
+
+FPrimaryAssetId UXRInteractionProfile::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(TEXT("XRInteractionProfile"), GetFName());
+}
@@ -0,0 +1,232 @@
+#include "XRInteractionSubsystem.h"
+#include "XRInteractionComponent.h"
+#include "XRInteractorComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+void UXRInteractionSubsystem::Deinitialize()
+{
+	InteractionsByComponent.Empty();
+	InteractionsByActor.Empty();
+	ComponentsByInteraction.Empty();
+	ActorByInteraction.Empty();
+	InteractionHandles.Empty();
+	InteractorHandles.Empty();
+	Super::Deinitialize();
+}
+
+UXRInteractionSubsystem* UXRInteractionSubsystem::Get(const UObject* InWorldContextObject)
+{
+	if (!InWorldContextObject)
+	{
+		return nullptr;
+	}
+	UWorld* World = InWorldContextObject->GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+	return World->GetSubsystem<UXRInteractionSubsystem>();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Registration
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRInteractionSubsystem::RegisterInteraction(UXRInteractionComponent* InInteraction)
+{
+	if (!InInteraction)
+	{
+		return;
+	}
+	// Re-registering (iE. after re-attachment) must not leave stale entries behind
+	UnregisterInteraction(InInteraction);
+	++RegistryGeneration;
+
+	AActor* Owner = InInteraction->GetOwner();
+	auto& RegisteredComponents = ComponentsByInteraction.Add(InInteraction);
+
+	// Every PrimitiveComponent above the Interaction owns it, including those of Actors it is attached to - mirrors GetChildrenComponents(true)
+	// from the PrimitiveComponents point of view. Actor attachment changes are picked up through RefreshActorInteractions.
+	// Detached Interactions are resolved through their anchor, the parent they had before detaching
+	for (USceneComponent* Parent = InInteraction->GetInteractionAnchor(); Parent; Parent = Parent->GetAttachParent())
+	{
+		if (UPrimitiveComponent* ParentPrimitive = Cast<UPrimitiveComponent>(Parent))
+		{
+			InteractionsByComponent.FindOrAdd(ParentPrimitive).AddUnique(InInteraction);
+			RegisteredComponents.Add(ParentPrimitive);
+		}
+	}
+
+	if (Owner)
+	{
+		InteractionsByActor.FindOrAdd(Owner).AddUnique(InInteraction);
+		ActorByInteraction.Add(InInteraction, Owner);
+	}
+}
+
+void UXRInteractionSubsystem::RegisterInteractionProxy(UXRInteractionComponent* InInteraction, UPrimitiveComponent* InProxy)
+{
+	if (!InInteraction || !InProxy)
+	{
+		return;
+	}
+	auto& RegisteredComponents = ComponentsByInteraction.FindOrAdd(InInteraction);
+	if (RegisteredComponents.Contains(InProxy))
+	{
+		return;
+	}
+	InteractionsByComponent.FindOrAdd(InProxy).AddUnique(InInteraction);
+	RegisteredComponents.Add(InProxy);
+	++RegistryGeneration;
+}
+
+void UXRInteractionSubsystem::UnregisterInteractionProxy(UXRInteractionComponent* InInteraction, UPrimitiveComponent* InProxy)
+{
+	if (!InInteraction || !InProxy)
+	{
+		return;
+	}
+	++RegistryGeneration;
+	if (auto* RegisteredComponents = ComponentsByInteraction.Find(InInteraction))
+	{
+		RegisteredComponents->Remove(InProxy);
+	}
+	if (FInteractionList* Interactions = InteractionsByComponent.Find(InProxy))
+	{
+		Interactions->Remove(InInteraction);
+		if (Interactions->Num() == 0)
+		{
+			InteractionsByComponent.Remove(InProxy);
+		}
+	}
+}
+
+void UXRInteractionSubsystem::RefreshActorInteractions(AActor* InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+	// Copy, registering modifies the Actors list
+	if (const FInteractionList* Interactions = InteractionsByActor.Find(InActor))
+	{
+		const FInteractionList ActorInteractions = *Interactions;
+		for (UXRInteractionComponent* Interaction : ActorInteractions)
+		{
+			RegisterInteraction(Interaction);
+			RegisterInteractionProxy(Interaction, Interaction->GetInteractionProxy());
+		}
+	}
+	// Their parent chain runs through this Actor as well
+	TArray<AActor*> AttachedActors;
+	InActor->GetAttachedActors(AttachedActors, true, true);
+	for (AActor* AttachedActor : AttachedActors)
+	{
+		if (const FInteractionList* Interactions = InteractionsByActor.Find(AttachedActor))
+		{
+			const FInteractionList ActorInteractions = *Interactions;
+			for (UXRInteractionComponent* Interaction : ActorInteractions)
+			{
+				RegisterInteraction(Interaction);
+				RegisterInteractionProxy(Interaction, Interaction->GetInteractionProxy());
+			}
+		}
+	}
+}
+
+void UXRInteractionSubsystem::UnregisterInteraction(UXRInteractionComponent* InInteraction)
+{
+	if (!InInteraction)
+	{
+		return;
+	}
+
+	++RegistryGeneration;
+	TArray<TObjectKey<UPrimitiveComponent>, TInlineAllocator<2>> RegisteredComponents;
+	if (ComponentsByInteraction.RemoveAndCopyValue(InInteraction, RegisteredComponents))
+	{
+		for (const TObjectKey<UPrimitiveComponent>& ComponentKey : RegisteredComponents)
+		{
+			if (FInteractionList* Interactions = InteractionsByComponent.Find(ComponentKey))
+			{
+				Interactions->Remove(InInteraction);
+				if (Interactions->Num() == 0)
+				{
+					InteractionsByComponent.Remove(ComponentKey);
+				}
+			}
+		}
+	}
+
+	TObjectKey<AActor> ActorKey;
+	if (ActorByInteraction.RemoveAndCopyValue(InInteraction, ActorKey))
+	{
+		if (FInteractionList* Interactions = InteractionsByActor.Find(ActorKey))
+		{
+			Interactions->Remove(InInteraction);
+			if (Interactions->Num() == 0)
+			{
+				InteractionsByActor.Remove(ActorKey);
+			}
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Handles
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+FXRInteractionHandle UXRInteractionSubsystem::AcquireInteractionHandle(UXRInteractionComponent* InInteraction)
+{
+	return InInteraction ? InteractionHandles.Acquire(InInteraction) : FXRInteractionHandle();
+}
+
+void UXRInteractionSubsystem::ReleaseInteractionHandle(const FXRInteractionHandle& InHandle)
+{
+	InteractionHandles.Release(InHandle);
+}
+
+FXRInteractorHandle UXRInteractionSubsystem::AcquireInteractorHandle(UXRInteractorComponent* InInteractor)
+{
+	return InInteractor ? InteractorHandles.Acquire(InInteractor) : FXRInteractorHandle();
+}
+
+void UXRInteractionSubsystem::ReleaseInteractorHandle(const FXRInteractorHandle& InHandle)
+{
+	InteractorHandles.Release(InHandle);
+}
+
+UXRInteractionComponent* UXRInteractionSubsystem::ResolveInteraction(const FXRInteractionHandle& InHandle) const
+{
+	return InteractionHandles.Resolve(InHandle);
+}
+
+UXRInteractorComponent* UXRInteractionSubsystem::ResolveInteractor(const FXRInteractorHandle& InHandle) const
+{
+	return InteractorHandles.Resolve(InHandle);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Lookup
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRInteractionSubsystem::GetInteractionsForComponent(const UPrimitiveComponent* InComponent, FInteractionList& OutInteractions) const
+{
+	OutInteractions.Reset();
+	if (!InComponent)
+	{
+		return;
+	}
+	if (const FInteractionList* Interactions = InteractionsByComponent.Find(InComponent))
+	{
+		OutInteractions.Append(*Interactions);
+	}
+}
+
+TArrayView<UXRInteractionComponent* const> UXRInteractionSubsystem::GetInteractionsForActor(const AActor* InActor) const
+{
+	if (!InActor)
+	{
+		return {};
+	}
+	const FInteractionList* Interactions = InteractionsByActor.Find(InActor);
+	return Interactions ? TArrayView<UXRInteractionComponent* const>(*Interactions) : TArrayView<UXRInteractionComponent* const>();
+}
@@ -16,17 +16,22 @@ void UXRInteractionTrigger::BeginPlay()
 	Super::BeginPlay();
 	if (GetTriggerState() != DefaultTriggerState)
 	{
-		Server_SetTriggerState(DefaultTriggerState, nullptr);
+		SetTriggerStateWithAuthority(DefaultTriggerState, nullptr);
 	}
 }
 
+bool UXRInteractionTrigger::RequiresReplicatedOwner() const
+{
+	return true;
+}
+
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 // Interaction Events
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UXRInteractionTrigger::StartInteraction(UXRInteractorComponent* InInteractor)
 {
 	// Only Interact for the first Interactor (if multiple)
-	if (GetActiveInteractors().Num() > 0)
+	if (GetActiveInteractorCount() > 0)
 	{
 		Super::StartInteraction(InInteractor);
 		return;
@@ -36,15 +41,15 @@ void UXRInteractionTrigger::StartInteraction(UXRInteractorComponent* InInteracto
 	switch (TriggerBehavior)
 	{
 		case EXRInteractionTriggerBehavior::Trigger:
-			Server_SetTriggerState(!DefaultTriggerState, InInteractor);
+			SetTriggerStateWithAuthority(!DefaultTriggerState, InInteractor);
 			EndInteractionAfterTimer();
 			break;
 		case EXRInteractionTriggerBehavior::Toggle:
-			Server_SetTriggerState(!GetTriggerState(), InInteractor);
+			SetTriggerStateWithAuthority(!GetTriggerState(), InInteractor);
 			EndInteractionAfterTimer();
 			break;
 		case EXRInteractionTriggerBehavior::Hold:
-			Server_SetTriggerState(!DefaultTriggerState, InInteractor);
+			SetTriggerStateWithAuthority(!DefaultTriggerState, InInteractor);
 			break;
 	}
 }
@@ -52,7 +57,7 @@ void UXRInteractionTrigger::StartInteraction(UXRInteractorComponent* InInteracto
 void UXRInteractionTrigger::EndInteraction(UXRInteractorComponent* InInteractor)
 {
 	// Only set TriggerState when last Interactor stops interacting 
-	if (GetActiveInteractors().Num() > 1)
+	if (GetActiveInteractorCount() > 1)
 	{
 		Super::EndInteraction(InInteractor);
 		return;
@@ -62,12 +67,12 @@ void UXRInteractionTrigger::EndInteraction(UXRInteractorComponent* InInteractor)
 	switch (TriggerBehavior)
 	{
 		case EXRInteractionTriggerBehavior::Trigger:
-			Server_SetTriggerState(DefaultTriggerState, InInteractor);
+			SetTriggerStateWithAuthority(DefaultTriggerState, InInteractor);
 			break;
 		case EXRInteractionTriggerBehavior::Toggle:
 			break;
 		case EXRInteractionTriggerBehavior::Hold:
-			Server_SetTriggerState(DefaultTriggerState, InInteractor);
+			SetTriggerStateWithAuthority(DefaultTriggerState, InInteractor);
 			break;
 	}
 }
@@ -80,6 +85,7 @@ void UXRInteractionTrigger::SetTriggerState(bool InTriggerState, UXRInteractorCo
 	if (GetWorld()->GetNetMode() == NM_Standalone)
 	{
 		bTriggerState = InTriggerState;
+		OnTriggerStateChangedNative.Broadcast(this, bTriggerState, InInteractor);
 		OnTriggerStateChanged.Broadcast(this, bTriggerState, InInteractor);
 		return;
 	}
@@ -95,10 +101,21 @@ void UXRInteractionTrigger::Server_SetTriggerState_Implementation(bool InTrigger
 	bTriggerState = InTriggerState;
 	if (GetWorld()->GetNetMode() == NM_Standalone)
 	{
+		OnTriggerStateChangedNative.Broadcast(this, bTriggerState, InInteractor);
 		OnTriggerStateChanged.Broadcast(this, bTriggerState, InInteractor);
 	}
 }
 
+// Start/EndInteraction run on every machine, only the server needs to apply the state - clients receive it via OnRep_TriggerState
+void UXRInteractionTrigger::SetTriggerStateWithAuthority(bool InTriggerState, UXRInteractorComponent* InInteractor)
+{
+	AActor* Owner = GetOwner();
+	if (Owner && Owner->HasAuthority())
+	{
+		Server_SetTriggerState(InTriggerState, InInteractor);
+	}
+}
+
 bool UXRInteractionTrigger::GetTriggerState() const
 {
 	return bTriggerState;
@@ -125,7 +142,13 @@ void UXRInteractionTrigger::EndInteractionAfterTimer()
 
 void UXRInteractionTrigger::RequestInteractionTermination()
 {
-	if (GetActiveInteractors().Num() > 0)
+	// The timer runs on every machine, the server alone terminates the Interaction for all of them - immediately, nothing is queued with authority
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority())
+	{
+		return;
+	}
+	if (GetActiveInteractorCount() > 0)
 	{
 		for (auto Interactor : GetActiveInteractors())
 		{
@@ -139,11 +162,13 @@ void UXRInteractionTrigger::RequestInteractionTermination()
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UXRInteractionTrigger::OnRep_TriggerState()
 {
-	if (GetActiveInteractors().Num() > 0)
+	if (GetActiveInteractorCount() > 0)
 	{
+		OnTriggerStateChangedNative.Broadcast(this, bTriggerState, GetActiveInteractors()[0]);
 		OnTriggerStateChanged.Broadcast(this, bTriggerState, GetActiveInteractors()[0]);
 		return;
 	}
+	OnTriggerStateChangedNative.Broadcast(this, bTriggerState, nullptr);
 	OnTriggerStateChanged.Broadcast(this, bTriggerState, nullptr);
 }
 
@@ -0,0 +1,196 @@
+#include "XRInteractorBatchSubsystem.h"
+#include "XRInteractorComponent.h"
+#include "XRInteractionComponent.h"
+#include "XRInteractionSubsystem.h"
+#include "XRToolsUtilityFunctions.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+
+// Below this many Interactors the batch is scored on the game thread, dispatching would cost more than it saves
+static constexpr int32 XRMinInteractorsForParallelScoring = 8;
+
+void UXRInteractorBatchSubsystem::Deinitialize()
+{
+	DirtyInteractors.Empty();
+	Jobs.Empty();
+	Candidates.Empty();
+	CandidateInteractions.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UXRInteractorBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXRInteractorBatchSubsystem, STATGROUP_Tickables);
+}
+
+UXRInteractorBatchSubsystem* UXRInteractorBatchSubsystem::Get(const UObject* InWorldContextObject)
+{
+	if (!InWorldContextObject)
+	{
+		return nullptr;
+	}
+	UWorld* World = InWorldContextObject->GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+	return World->GetSubsystem<UXRInteractorBatchSubsystem>();
+}
+
+void UXRInteractorBatchSubsystem::MarkHoverDirty(UXRInteractorComponent* InInteractor)
+{
+	if (InInteractor)
+	{
+		DirtyInteractors.Add(InInteractor);
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Batch
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRInteractorBatchSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	if (DirtyInteractors.Num() == 0)
+	{
+		return;
+	}
+
+	GatherJobs();
+
+	const TArrayView<const FHoverCandidate> CandidateView(Candidates);
+	ParallelFor(Jobs.Num(), [this, CandidateView](int32 JobIndex)
+	{
+		ScoreJob(Jobs[JobIndex], CandidateView);
+	}, Jobs.Num() < XRMinInteractorsForParallelScoring ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	for (const FHoverJob& Job : Jobs)
+	{
+		ApplyJob(Job);
+	}
+}
+
+// [GameThread] Flatten every dirty Interactors overlapped components and their Interactions into plain data
+void UXRInteractorBatchSubsystem::GatherJobs()
+{
+	Jobs.Reset();
+	Candidates.Reset();
+	CandidateInteractions.Reset();
+
+	UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this);
+	if (!InteractionSubsystem)
+	{
+		DirtyInteractors.Reset();
+		return;
+	}
+
+	UXRInteractionSubsystem::FInteractionList ComponentInteractions;
+	for (const TWeakObjectPtr<UXRInteractorComponent>& WeakInteractor : DirtyInteractors)
+	{
+		UXRInteractorComponent* Interactor = WeakInteractor.Get();
+		if (!Interactor)
+		{
+			continue;
+		}
+		FHoverJob& Job = Jobs.AddDefaulted_GetRef();
+		Job.Interactor = Interactor;
+		Job.FirstCandidate = Candidates.Num();
+
+		const FVector InteractorLocation = Interactor->GetComponentLocation();
+		int32 GroupIndex = 0;
+		for (const auto& Overlap : Interactor->OverlapCounts)
+		{
+			InteractionSubsystem->GetInteractionsForComponent(Overlap.Key.Get(), ComponentInteractions);
+			for (UXRInteractionComponent* Interaction : ComponentInteractions)
+			{
+				if (!UXRToolsUtilityFunctions::IsXRInteractionSelectable(Interaction, Interactor))
+				{
+					continue;
+				}
+				FHoverCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+				Candidate.InteractionIndex = CandidateInteractions.Add(Interaction);
+				Candidate.GroupIndex = GroupIndex;
+				Candidate.Priority = Interaction->GetInteractionPriority();
+				Candidate.DistanceSquared = FVector::DistSquared(InteractorLocation, Interaction->GetInteractionLocation());
+			}
+			GroupIndex++;
+		}
+		Job.NumCandidates = Candidates.Num() - Job.FirstCandidate;
+	}
+
+	// Interactors that still overlap something are rescored every frame, their candidates may move or change priority / selectability
+	// without any overlap event. The others are dropped until their overlaps change again.
+	for (auto It = DirtyInteractors.CreateIterator(); It; ++It)
+	{
+		const UXRInteractorComponent* Interactor = It->Get();
+		if (!Interactor || Interactor->OverlapCounts.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+// [AnyThread] Same selection as GetXRInteractionByPriority(..., 0, LowerEqual) per overlapped component, ties are resolved by distance to the Interactor
+void UXRInteractorBatchSubsystem::ScoreJob(FHoverJob& InOutJob, TArrayView<const FHoverCandidate> InCandidates)
+{
+	InOutJob.SelectedInteractions.Reset();
+	const FHoverCandidate* Best = nullptr;
+	const int32 LastCandidate = InOutJob.FirstCandidate + InOutJob.NumCandidates;
+	for (int32 CandidateIndex = InOutJob.FirstCandidate; CandidateIndex < LastCandidate; CandidateIndex++)
+	{
+		const FHoverCandidate& Candidate = InCandidates[CandidateIndex];
+		if (Best && Best->GroupIndex != Candidate.GroupIndex)
+		{
+			InOutJob.SelectedInteractions.AddUnique(Best->InteractionIndex);
+			Best = nullptr;
+		}
+		if (Candidate.Priority < 0)
+		{
+			continue;
+		}
+		if (!Best || Candidate.Priority < Best->Priority || (Candidate.Priority == Best->Priority && Candidate.DistanceSquared < Best->DistanceSquared))
+		{
+			Best = &Candidate;
+		}
+	}
+	if (Best)
+	{
+		InOutJob.SelectedInteractions.AddUnique(Best->InteractionIndex);
+	}
+}
+
+// [GameThread] Diff the scored selection against the Interactors current hover state
+void UXRInteractorBatchSubsystem::ApplyJob(const FHoverJob& InJob)
+{
+	UXRInteractorComponent* Interactor = InJob.Interactor;
+	if (!IsValid(Interactor))
+	{
+		return;
+	}
+	TArray<UXRInteractionComponent*, TInlineAllocator<4>> SelectedInteractions = {};
+	for (const int32 InteractionIndex : InJob.SelectedInteractions)
+	{
+		SelectedInteractions.AddUnique(CandidateInteractions[InteractionIndex]);
+	}
+
+	// Copy, as hover callbacks may modify the hover state
+	const TArray<FXRInteractionHandle, TInlineAllocator<4>> PreviouslyHovered = Interactor->HoveredInteractionHandles;
+	const UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(Interactor);
+	for (const FXRInteractionHandle& Hovered : PreviouslyHovered)
+	{
+		UXRInteractionComponent* HoveredInteraction = InteractionSubsystem ? InteractionSubsystem->ResolveInteraction(Hovered) : nullptr;
+		if (!HoveredInteraction)
+		{
+			// Ended play while hovered
+			Interactor->HoveredInteractionHandles.Remove(Hovered);
+		}
+		else if (!SelectedInteractions.Contains(HoveredInteraction))
+		{
+			Interactor->RequestHover(HoveredInteraction, false);
+		}
+	}
+	for (UXRInteractionComponent* Selected : SelectedInteractions)
+	{
+		Interactor->RequestHover(Selected, true);
+	}
+}
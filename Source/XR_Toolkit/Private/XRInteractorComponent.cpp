@@ -2,16 +2,26 @@
 
 #include "XRInteractorComponent.h"
 #include "XRInteractionComponent.h"
+#include "XRInteractionSubsystem.h"
+#include "XRInteractorBatchSubsystem.h"
 #include "XRToolsUtilityFunctions.h"
+#include "XR_Toolkit.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 UXRInteractorComponent::UXRInteractorComponent()
 {
 	SphereRadius = 1.0f;
-	PrimaryComponentTick.bCanEverTick = false;
+	// Only ticks while Interaction Commands are queued, flushing them once at the end of the frame
+	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_LastDemotable;
 	SetIsReplicatedByDefault(true);
 	bAutoActivate = true;
+	ActiveInteractionComponents.OwningInteractor = this;
 }
 
 void UXRInteractorComponent::InitializeComponent()
@@ -23,8 +33,84 @@ void UXRInteractorComponent::InitializeComponent()
 void UXRInteractorComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	OnComponentBeginOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapBegin);
-	OnComponentEndOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapEnd);
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		InteractorHandle = InteractionSubsystem->AcquireInteractorHandle(this);
+	}
+	if (bOverlapInteractionProxiesOnly && !IsOverlappingInteractionProxiesOnly())
+	{
+		UE_LOG(LogXRToolkit, Warning, TEXT("%s: bOverlapInteractionProxiesOnly requires a project collision channel as InteractionProxyChannel, overlapping all Interactions instead."), *GetPathName());
+	}
+	if (IsUsingAsyncQuery())
+	{
+		if (!UXRToolsUtilityFunctions::IsProjectCollisionChannel(GetQueryChannel()))
+		{
+			UE_LOG(LogXRToolkit, Warning, TEXT("%s: AsyncQuery on an engine collision channel overlaps every object in range, set up a dedicated QueryChannel."), *GetPathName());
+		}
+		AsyncOverlapDelegate.BindUObject(this, &UXRInteractorComponent::OnAsyncOverlapQueryCompleted);
+		RefreshOverlapsImmediate();
+		GetWorld()->GetTimerManager().SetTimer(HoverQueryTimer, this, &UXRInteractorComponent::IssueAsyncOverlapQuery, FMath::Max(HoverQueryInterval, KINDA_SMALL_NUMBER), true);
+		return;
+	}
+	if (IsOverlappingInteractionProxiesOnly())
+	{
+		RebuildProxySensors();
+	}
+	else
+	{
+		OnComponentBeginOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapBegin);
+		OnComponentEndOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapEnd);
+	}
+	RebuildOverlapTable();
+}
+
+void UXRInteractorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(HoverQueryTimer);
+	}
+	AsyncOverlapDelegate.Unbind();
+	DestroyProxySensors();
+
+	// Interactions only hold this Interactors handle, leave them with an exact hover and interaction state
+	if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this))
+	{
+		for (const FXRInteractionHandle& Hovered : HoveredInteractionHandles)
+		{
+			if (UXRInteractionComponent* HoveredInteraction = InteractionSubsystem->ResolveInteraction(Hovered))
+			{
+				HoveredInteraction->RemoveInteractor(InteractorHandle);
+			}
+		}
+		for (const FXRActiveInteractionItem& Item : ActiveInteractionComponents.Items)
+		{
+			if (Item.Interaction)
+			{
+				Item.Interaction->RemoveInteractor(InteractorHandle);
+			}
+		}
+		for (const auto& Predicted : PredictedInteractions)
+		{
+			if (Predicted.Key.IsValid())
+			{
+				Predicted.Key->RemoveInteractor(InteractorHandle);
+			}
+		}
+		InteractionSubsystem->ReleaseInteractorHandle(InteractorHandle);
+	}
+	PredictedInteractions.Reset();
+	PredictedStops.Reset();
+	ServerPredictionKeys.Reset();
+	HoveredInteractionHandles.Reset();
+	InteractorHandle.Reset();
+	Super::EndPlay(EndPlayReason);
+}
+
+void UXRInteractorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	FlushInteractionCommands();
 }
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -32,8 +118,12 @@ void UXRInteractorComponent::BeginPlay()
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UXRInteractorComponent::StartXRInteractionByPriority(int32 InPriority, EXRInteractionPrioritySelection InPrioritySelectionCondition)
 {
-	TArray<AActor*> OverlappedActors = {};
-	UXRInteractionComponent* InteractionToStart = UXRToolsUtilityFunctions::GetXRInteractionByPriority(GetOverlappedXRInteractions(), this);
+	// The periodic hover query may be outdated by up to one interval
+	if (IsUsingAsyncQuery())
+	{
+		RefreshOverlapsImmediate();
+	}
+	UXRInteractionComponent* InteractionToStart = UXRToolsUtilityFunctions::GetXRInteractionByPriority(GetOverlappedXRInteractionsView(), this, InPriority, InPrioritySelectionCondition);
 	if (InteractionToStart)
 	{
 		StartXRInteraction(InteractionToStart);
@@ -51,59 +141,76 @@ void UXRInteractorComponent::StartXRInteraction(UXRInteractionComponent* InInter
 		return;
 	}
 
+	uint16 PredictionKey = 0;
+	if (ShouldPredictInteraction(InInteractionComponent))
+	{
+		// 0 is reserved for "not predicted"
+		LastPredictionKey = LastPredictionKey == MAX_uint16 ? 1 : LastPredictionKey + 1;
+		PredictionKey = LastPredictionKey;
+		PredictedInteractions.Add(InInteractionComponent, PredictionKey);
+		ApplyInteractionStart(InInteractionComponent);
+	}
+
+	// Stop other Interaction if TakeOver - the transfer itself is applied by the server
+	const bool bTakeOver = InInteractionComponent->GetMultiInteractorBehavior() == EXRMultiInteractorBehavior::TakeOver && InInteractionComponent->IsInteractedWith();
+	QueueInteractionCommand(bTakeOver ? EXRInteractionCommandType::TakeOver : EXRInteractionCommandType::Start, InInteractionComponent, PredictionKey);
+}
+
+// [Server] Implementation for starting interaction with a component, adds to active interactions and sets the Owner of the Interacted Actor to this Components Owner (to grant Authority)
+bool UXRInteractorComponent::ExecuteInteraction(UXRInteractionComponent* InInteractionComponent)
+{
+	if (!InInteractionComponent || !InInteractionComponent->IsActive())
+	{
+		return false;
+	}
+	if (InInteractionComponent->HasActiveInteractor(this))
+	{
+		return false;
+	}
+
 	// Stop other Interaction if TakeOver, return if Blocked, Start Interaction if Allowed
-	auto ActiveInteractors = InInteractionComponent->GetActiveInteractors();
-	if (ActiveInteractors.Num() > 0)
+	if (InInteractionComponent->IsInteractedWith())
 	{
 		switch (InInteractionComponent->GetMultiInteractorBehavior())
 		{
 			case EXRMultiInteractorBehavior::TakeOver:
-				for (auto Interactor : ActiveInteractors)
+				for (UXRInteractorComponent* Interactor : InInteractionComponent->GetActiveInteractors())
 				{
 					if (Interactor != this)
 					{
-						Interactor->Server_TerminateInteraction(InInteractionComponent);
+						Interactor->TerminateInteraction(InInteractionComponent);
 					}
 				}
 				break;
+			case EXRMultiInteractorBehavior::Disabled:
+				return false;
 			default:
 				break;
 		}
 	}
-	Server_ExecuteInteraction(InInteractionComponent);
-}
 
-// [Server] Implementation for starting interaction with a component, adds to active interactions and sets the Owner of the Interacted Actor to this Components Owner (to grant Authority)
-void UXRInteractorComponent::Server_ExecuteInteraction_Implementation(UXRInteractionComponent* InInteractionComponent)
-{
-	if (!InInteractionComponent)
-	{
-		return;
-	}
 	if (InInteractionComponent->GetOwner() && GetOwner())
 	{
 		InInteractionComponent->GetOwner()->SetOwner(GetOwner());
 	}
-	ActiveInteractionComponents.AddUnique(InInteractionComponent);
-	Multicast_ExecuteInteraction(InInteractionComponent);
+	ActiveInteractionComponents.AddInteraction(InInteractionComponent);
+	ApplyInteractionStart(InInteractionComponent);
+	return true;
 }
 
-void UXRInteractorComponent::Multicast_ExecuteInteraction_Implementation(UXRInteractionComponent* InteractionComponent)
+void UXRInteractorComponent::ApplyInteractionStart(UXRInteractionComponent* InInteractionComponent)
 {
-	if (!InteractionComponent)
-	{
-		return;
-	}
-	InteractionComponent->StartInteraction(this);
-	OnStartedInteracting.Broadcast(this, InteractionComponent);
-	HoveredInteractionComponents.Remove(InteractionComponent);
+	InInteractionComponent->StartInteraction(this);
+	OnStartedInteractingNative.Broadcast(this, InInteractionComponent);
+	OnStartedInteracting.Broadcast(this, InInteractionComponent);
+	HoveredInteractionHandles.Remove(InInteractionComponent->GetInteractionHandle());
 }
 
 
 void UXRInteractorComponent::StopXRInteractionByPriority(int32 InPriority, EXRInteractionPrioritySelection InPrioritySelectionCondition)
 {
 	UXRInteractionComponent* InteractionToStop = nullptr;
-	if (ActiveInteractionComponents.Num() > 0)
+	if (IsInteracting())
 	{
 		// Provide nullptr instead of this interactor to ensure Interactions that this Interactor is active on are not discarded
 		InteractionToStop = UXRToolsUtilityFunctions::GetXRInteractionByPriority(GetActiveInteractions(), nullptr, InPriority, InPrioritySelectionCondition);
@@ -119,7 +226,7 @@ void UXRInteractorComponent::StopAllXRInteractions()
 {
 	auto ActiveInteractions = GetActiveInteractions();
 	for (UXRInteractionComponent* ActiveInteraction : ActiveInteractions) {
-		Server_TerminateInteraction(ActiveInteraction);
+		QueueStopInteraction(ActiveInteraction);
 	}
 }
 
@@ -129,97 +236,386 @@ void UXRInteractorComponent::StopXRInteraction(UXRInteractionComponent* InXRInte
 	{
 		return;
 	}
-	Server_TerminateInteraction(InXRInteraction);
+	QueueStopInteraction(InXRInteraction);
 }
 
 // [Server] Implementation for stopping interaction with a component, removes from active interactions if continuous
-void UXRInteractorComponent::Server_TerminateInteraction_Implementation(UXRInteractionComponent* InInteractionComponent)
+void UXRInteractorComponent::TerminateInteraction(UXRInteractionComponent* InInteractionComponent)
 {
 	if (!InInteractionComponent)
 	{
 		return;
 	}
-	ActiveInteractionComponents.Remove(InInteractionComponent);
-	Multicast_TerminateInteraction(InInteractionComponent);
+	if (!ActiveInteractionComponents.RemoveInteraction(InInteractionComponent))
+	{
+		return;
+	}
+	// The start may never have replicated to the predicting client, tell it explicitly
+	uint16 PredictionKey = 0;
+	if (ServerPredictionKeys.RemoveAndCopyValue(InInteractionComponent, PredictionKey))
+	{
+		FXRInteractionPredictionResult& Result = PendingPredictionResults.AddDefaulted_GetRef();
+		Result.PredictionKey = PredictionKey;
+		Result.bAccepted = true;
+		Result.bEnded = true;
+		FlushPredictionResults();
+	}
+	ApplyInteractionEnd(InInteractionComponent);
+}
+
+void UXRInteractorComponent::ApplyInteractionEnd(UXRInteractionComponent* InInteractionComponent)
+{
+	InInteractionComponent->EndInteraction(this);
+	OnStoppedInteractingNative.Broadcast(this, InInteractionComponent);
+	OnStoppedInteracting.Broadcast(this, InInteractionComponent);
+
+	// Restart Highlight after Interaction End (if hovering)
+	RestoreHover(InInteractionComponent);
 }
 
-void UXRInteractorComponent::Multicast_TerminateInteraction_Implementation(UXRInteractionComponent* InteractionComponent)
+void UXRInteractorComponent::RestoreHover(UXRInteractionComponent* InInteractionComponent)
 {
-	if (!InteractionComponent)
+	if (DeferHoverToBatch())
 	{
 		return;
 	}
-	InteractionComponent->EndInteraction(this);
-	OnStoppedInteracting.Broadcast(this, InteractionComponent);
+	if (GetOverlappedXRInteractionsView().Contains(InInteractionComponent))
+	{
+		RequestHover(InInteractionComponent, true);
+	}
+}
 
-	// Restart Highlight after Interaction End (if hovering)
-	if (GetOverlappedXRInteractions().Contains(InteractionComponent))
+void UXRInteractorComponent::OnActiveInteractionReplicated(UXRInteractionComponent* InInteractionComponent)
+{
+	// Already started locally by Prediction - the authoritative start confirms it
+	if (PredictedInteractions.Remove(InInteractionComponent) > 0)
+	{
+		return;
+	}
+	// Started and already stopped again locally, the matching removal follows
+	if (PredictedStops.Contains(InInteractionComponent))
+	{
+		return;
+	}
+	ApplyInteractionStart(InInteractionComponent);
+}
+
+void UXRInteractorComponent::OnActiveInteractionRemoved(UXRInteractionComponent* InInteractionComponent)
+{
+	if (PredictedStops.Remove(InInteractionComponent) > 0)
 	{
-		RequestHover(InteractionComponent, true);
+		return;
 	}
+	ApplyInteractionEnd(InInteractionComponent);
 }
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
-// Utility
+// Active Interactions
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
-bool UXRInteractorComponent::CanInteract(UXRInteractionComponent*& OutPrioritizedXRInteraction, int32 InPriority, EXRInteractionPrioritySelection InPrioritySelectionCondition)
+void FXRActiveInteractionItem::PostReplicatedAdd(const FXRActiveInteractionArray& InArraySerializer)
 {
-	OutPrioritizedXRInteraction = UXRToolsUtilityFunctions::GetXRInteractionByPriority(GetOverlappedXRInteractions(), this);
-	return OutPrioritizedXRInteraction != nullptr;
+	if (Interaction && InArraySerializer.OwningInteractor)
+	{
+		bApplied = true;
+		InArraySerializer.OwningInteractor->OnActiveInteractionReplicated(Interaction);
+	}
+}
+
+void FXRActiveInteractionItem::PostReplicatedChange(const FXRActiveInteractionArray& InArraySerializer)
+{
+	// The Interaction was not resolvable when the item was added (iE. its Actor replicated after the Interactor)
+	if (!bApplied)
+	{
+		PostReplicatedAdd(InArraySerializer);
+	}
 }
 
+void FXRActiveInteractionItem::PreReplicatedRemove(const FXRActiveInteractionArray& InArraySerializer)
+{
+	if (bApplied && Interaction && InArraySerializer.OwningInteractor)
+	{
+		bApplied = false;
+		InArraySerializer.OwningInteractor->OnActiveInteractionRemoved(Interaction);
+	}
+}
 
-TArray<UXRInteractionComponent*> UXRInteractorComponent::GetOverlappedXRInteractions() const
+bool FXRActiveInteractionArray::AddInteraction(UXRInteractionComponent* InInteraction)
 {
-	TArray<UXRInteractionComponent*> FoundXRInteractions = {};
+	if (!InInteraction || Contains(InInteraction))
+	{
+		return false;
+	}
+	FXRActiveInteractionItem& Item = Items.AddDefaulted_GetRef();
+	Item.Interaction = InInteraction;
+	Item.bApplied = true;
+	MarkItemDirty(Item);
+	return true;
+}
 
-	TArray<UPrimitiveComponent*> OverlappingComps = {};
-	GetOverlappingComponents(OverlappingComps);
-	for (auto Collider : AdditionalColliders)
+bool FXRActiveInteractionArray::RemoveInteraction(UXRInteractionComponent* InInteraction)
+{
+	const int32 Index = Items.IndexOfByPredicate([InInteraction](const FXRActiveInteractionItem& Item) { return Item.Interaction == InInteraction; });
+	if (Index == INDEX_NONE)
 	{
-		TArray<UPrimitiveComponent*> AdditionalOverlappingComps = {};
-		Collider->GetOverlappingComponents(AdditionalOverlappingComps);
-		for (auto AdditionalOverlappingComp : AdditionalOverlappingComps)
+		return false;
+	}
+	Items.RemoveAtSwap(Index);
+	MarkArrayDirty();
+	return true;
+}
+
+bool FXRActiveInteractionArray::Contains(const UXRInteractionComponent* InInteraction) const
+{
+	return Items.ContainsByPredicate([InInteraction](const FXRActiveInteractionItem& Item) { return Item.Interaction == InInteraction; });
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Prediction
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool UXRInteractorComponent::ShouldPredictInteraction(UXRInteractionComponent* InInteractionComponent) const
+{
+	// Only the owning client predicts, the server and standalone start Interactions immediately anyway
+	if (!bPredictInteractionStart || GetOwnerRole() != ROLE_AutonomousProxy)
+	{
+		return false;
+	}
+	if (PredictedInteractions.Contains(InInteractionComponent) || PredictedStops.Contains(InInteractionComponent) || InInteractionComponent->HasActiveInteractor(this))
+	{
+		return false;
+	}
+	// Do not predict what the server is going to reject
+	if (InInteractionComponent->IsInteractedWith() && InInteractionComponent->GetMultiInteractorBehavior() == EXRMultiInteractorBehavior::Disabled)
+	{
+		return false;
+	}
+	return true;
+}
+
+void UXRInteractorComponent::Client_ReconcilePredictions_Implementation(const TArray<FXRInteractionPredictionResult>& InResults)
+{
+	for (const FXRInteractionPredictionResult& Result : InResults)
+	{
+		if (Result.bEnded)
+		{
+			ReconcileEndedPrediction(Result.PredictionKey);
+			continue;
+		}
+		if (Result.bAccepted)
+		{
+			// Confirmed once the Interaction replicates into ActiveInteractionComponents, or ended by a bEnded result if it never does
+			continue;
+		}
+		// Rejected after it was already stopped locally, nothing left to undo
+		for (auto It = PredictedStops.CreateIterator(); It; ++It)
+		{
+			if (It->Value == Result.PredictionKey)
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+		for (auto It = PredictedInteractions.CreateIterator(); It; ++It)
+		{
+			if (It->Value != Result.PredictionKey)
+			{
+				continue;
+			}
+			UXRInteractionComponent* RejectedInteraction = It->Key.Get();
+			It.RemoveCurrent();
+			if (RejectedInteraction)
+			{
+				RejectedInteraction->RollbackInteraction(this);
+				OnStoppedInteractingNative.Broadcast(this, RejectedInteraction);
+				OnStoppedInteracting.Broadcast(this, RejectedInteraction);
+				RestoreHover(RejectedInteraction);
+			}
+			break;
+		}
+	}
+}
+
+void UXRInteractorComponent::ReconcileEndedPrediction(uint16 InPredictionKey)
+{
+	for (auto It = PredictedInteractions.CreateIterator(); It; ++It)
+	{
+		if (It->Value != InPredictionKey)
 		{
-			OverlappingComps.AddUnique(AdditionalOverlappingComp);
+			continue;
 		}
+		UXRInteractionComponent* EndedInteraction = It->Key.Get();
+		It.RemoveCurrent();
+		// Otherwise its start replicated, the replicated removal ends it
+		if (EndedInteraction && !ActiveInteractionComponents.Contains(EndedInteraction))
+		{
+			ApplyInteractionEnd(EndedInteraction);
+		}
+		return;
+	}
+	for (auto It = PredictedStops.CreateIterator(); It; ++It)
+	{
+		if (It->Value != InPredictionKey)
+		{
+			continue;
+		}
+		// Keep swallowing the removal if the start replicated, nothing else will arrive otherwise
+		if (!It->Key.IsValid() || !ActiveInteractionComponents.Contains(It->Key.Get()))
+		{
+			It.RemoveCurrent();
+		}
+		return;
+	}
+}
+
+void UXRInteractorComponent::QueueStopInteraction(UXRInteractionComponent* InInteractionComponent)
+{
+	uint16 PredictionKey = 0;
+	if (PredictedInteractions.RemoveAndCopyValue(InInteractionComponent, PredictionKey))
+	{
+		PredictedStops.Add(InInteractionComponent, PredictionKey);
+		ApplyInteractionEnd(InInteractionComponent);
+	}
+	QueueInteractionCommand(EXRInteractionCommandType::Stop, InInteractionComponent);
+}
+
+void UXRInteractorComponent::FlushPredictionResults()
+{
+	if (bExecutingInteractionCommands || PendingPredictionResults.Num() == 0)
+	{
+		return;
+	}
+	Client_ReconcilePredictions(PendingPredictionResults);
+	PendingPredictionResults.Reset();
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Command Buffer
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRInteractorComponent::QueueInteractionCommand(EXRInteractionCommandType InType, UXRInteractionComponent* InInteractionComponent, uint16 InPredictionKey)
+{
+	FXRInteractionCommand Command;
+	Command.Type = InType;
+	Command.Interaction = InInteractionComponent;
+	Command.PredictionKey = InPredictionKey;
+
+	// Server and standalone apply right away, so IsInteracting / GetActiveInteractions are up to date for the caller
+	if (GetOwner()->HasAuthority())
+	{
+		ExecuteInteractionCommand(Command);
+		FlushPredictionResults();
+		return;
+	}
+	PendingInteractionCommands.Add(Command);
+	SetComponentTickEnabled(true);
+}
+
+void UXRInteractorComponent::FlushInteractionCommands()
+{
+	SetComponentTickEnabled(false);
+	if (PendingInteractionCommands.Num() == 0)
+	{
+		return;
+	}
+	Server_ExecuteInteractionCommands(PendingInteractionCommands);
+	PendingInteractionCommands.Reset();
+}
+
+void UXRInteractorComponent::Server_ExecuteInteractionCommands_Implementation(const TArray<FXRInteractionCommand>& InCommands)
+{
+	bExecutingInteractionCommands = true;
+	for (const FXRInteractionCommand& Command : InCommands)
+	{
+		ExecuteInteractionCommand(Command);
 	}
+	bExecutingInteractionCommands = false;
+	FlushPredictionResults();
+}
 
-	for (UPrimitiveComponent* OverlappingComponent : OverlappingComps)
+void UXRInteractorComponent::ExecuteInteractionCommand(const FXRInteractionCommand& InCommand)
+{
+	switch (InCommand.Type)
 	{
-		// check if any of the child components are XRInteractions 
-		TArray<USceneComponent*> ChildComponents;
-		OverlappingComponent->GetChildrenComponents(true, ChildComponents);
-		for (USceneComponent* ChildComponent : ChildComponents)
+		// The server re-evaluates the MultiInteractorBehavior, a client side TakeOver may be outdated by the time it arrives
+		case EXRInteractionCommandType::Start:
+		case EXRInteractionCommandType::TakeOver:
 		{
-			UXRInteractionComponent* FoundXRInteraction = Cast<UXRInteractionComponent>(ChildComponent);
-			if (FoundXRInteraction)
+			const bool bExecuted = ExecuteInteraction(InCommand.Interaction);
+			if (InCommand.PredictionKey != 0)
 			{
-				FoundXRInteractions.Add(FoundXRInteraction);
+				FXRInteractionPredictionResult& Result = PendingPredictionResults.AddDefaulted_GetRef();
+				Result.PredictionKey = InCommand.PredictionKey;
+				Result.bAccepted = bExecuted;
+				if (bExecuted)
+				{
+					ServerPredictionKeys.Add(InCommand.Interaction, InCommand.PredictionKey);
+				}
 			}
+			break;
 		}
+		case EXRInteractionCommandType::Stop:
+			TerminateInteraction(InCommand.Interaction);
+			break;
 	}
-	return FoundXRInteractions;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Utility
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool UXRInteractorComponent::CanInteract(UXRInteractionComponent*& OutPrioritizedXRInteraction, int32 InPriority, EXRInteractionPrioritySelection InPrioritySelectionCondition)
+{
+	OutPrioritizedXRInteraction = UXRToolsUtilityFunctions::GetXRInteractionByPriority(GetOverlappedXRInteractionsView(), this, InPriority, InPrioritySelectionCondition);
+	return OutPrioritizedXRInteraction != nullptr;
+}
+
+
+TArray<UXRInteractionComponent*> UXRInteractorComponent::GetOverlappedXRInteractions() const
+{
+	return TArray<UXRInteractionComponent*>(GetOverlappedXRInteractionsView());
+}
+
+TArrayView<UXRInteractionComponent* const> UXRInteractorComponent::GetOverlappedXRInteractionsView() const
+{
+	// Only overlap changes and Interactions (un)registering change the result
+	UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this);
+	const uint32 RegistryGeneration = InteractionSubsystem ? InteractionSubsystem->GetRegistryGeneration() : 0;
+	if (bOverlappedInteractionsValid && CachedOverlappedInteractionsGeneration == RegistryGeneration)
+	{
+		return CachedOverlappedInteractions;
+	}
+	CachedOverlappedInteractions.Reset();
+	CachedOverlappedInteractionsGeneration = RegistryGeneration;
+	bOverlappedInteractionsValid = true;
+
+	if (!InteractionSubsystem)
+	{
+		return CachedOverlappedInteractions;
+	}
+	UXRInteractionSubsystem::FInteractionList ComponentInteractions;
+	for (const auto& OverlapCount : OverlapCounts)
+	{
+		InteractionSubsystem->GetInteractionsForComponent(OverlapCount.Key.Get(), ComponentInteractions);
+		for (UXRInteractionComponent* Interaction : ComponentInteractions)
+		{
+			CachedOverlappedInteractions.AddUnique(Interaction);
+		}
+	}
+	return CachedOverlappedInteractions;
+}
+
+void UXRInteractorComponent::InvalidateOverlappedInteractions()
+{
+	bOverlappedInteractionsValid = false;
 }
 
 TArray<AActor*> UXRInteractorComponent::GetAllOverlappingActors() const
 {
 	TArray<AActor*> OverlappingActors = {};
-	TArray<AActor*> TempActors = {};
-	GetOverlappingActors(OverlappingActors);
-
-	for (UPrimitiveComponent* AdditionalCollider : AdditionalColliders)
+	for (const auto& OverlapCount : OverlapCounts)
 	{
-		if (AdditionalCollider)
+		if (UPrimitiveComponent* OverlappedComponent = OverlapCount.Key.Get())
 		{
-			TempActors.Empty();
-			AdditionalCollider->GetOverlappingActors(TempActors);
-			for (AActor* Actor : TempActors)
+			if (AActor* Actor = OverlappedComponent->GetOwner())
 			{
-				if (Actor && !OverlappingActors.Contains(Actor))
-				{
-					OverlappingActors.AddUnique(Actor);
-				}
+				OverlappingActors.AddUnique(Actor);
 			}
 		}
 	}
@@ -229,18 +625,14 @@ TArray<AActor*> UXRInteractorComponent::GetAllOverlappingActors() const
 
 TArray<UXRInteractionComponent*> UXRInteractorComponent::GetChildXRInteractionComponents(UPrimitiveComponent* InComponent)
 {
-	TArray<UXRInteractionComponent*> FoundXRInteractions = {};
-	TArray<USceneComponent*> ChildComponents;
-	InComponent->GetChildrenComponents(true, ChildComponents);
-	for (USceneComponent* ChildComponent : ChildComponents)
+	UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this);
+	if (!InteractionSubsystem)
 	{
-		UXRInteractionComponent* FoundXRInteraction = Cast<UXRInteractionComponent>(ChildComponent);
-		if (FoundXRInteraction)
-		{
-			FoundXRInteractions.Add(FoundXRInteraction);
-		}
+		return {};
 	}
-	return FoundXRInteractions;
+	UXRInteractionSubsystem::FInteractionList Interactions;
+	InteractionSubsystem->GetInteractionsForComponent(InComponent, Interactions);
+	return TArray<UXRInteractionComponent*>(Interactions);
 }
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -260,14 +652,27 @@ void UXRInteractorComponent::SetAdditionalColliders(TArray<UPrimitiveComponent*>
 		}
 	}
 	AdditionalColliders = InColliders;
-	for (UPrimitiveComponent* Collider : AdditionalColliders)
+	if (IsUsingAsyncQuery())
 	{
-		if (Collider)
+		RefreshOverlapsImmediate();
+		return;
+	}
+	if (IsOverlappingInteractionProxiesOnly())
+	{
+		RebuildProxySensors();
+	}
+	else
+	{
+		for (UPrimitiveComponent* Collider : AdditionalColliders)
 		{
-			Collider->OnComponentBeginOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapBegin);
-			Collider->OnComponentEndOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapEnd);
+			if (Collider)
+			{
+				Collider->OnComponentBeginOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapBegin);
+				Collider->OnComponentEndOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapEnd);
+			}
 		}
 	}
+	RebuildOverlapTable();
 }
 
 TArray<UPrimitiveComponent*> UXRInteractorComponent::GetAdditionalColliders() const
@@ -275,43 +680,368 @@ TArray<UPrimitiveComponent*> UXRInteractorComponent::GetAdditionalColliders() co
 	return AdditionalColliders;
 }
 
-bool UXRInteractorComponent::IsAnyColliderOverlappingComponent(UPrimitiveComponent* InComponent, bool IgnoreSelf)
+bool UXRInteractorComponent::IsAnyColliderOverlappingComponent(UPrimitiveComponent* InComponent) const
+{
+	return InComponent && OverlapCounts.Contains(InComponent);
+}
+
+void UXRInteractorComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	AddOverlap(OtherComp);
+}
+
+void UXRInteractorComponent::OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	RemoveOverlap(OtherComp);
+}
+
+// Each Begin/EndOverlap of any collider (self or AdditionalColliders) counts towards the overlapped component, 
+// only the first begin and the last end change the hover state.
+void UXRInteractorComponent::AddOverlap(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+	int32& OverlapCount = OverlapCounts.FindOrAdd(InComponent);
+	OverlapCount++;
+	if (OverlapCount == 1)
+	{
+		OnComponentOverlapStarted(InComponent);
+	}
+}
+
+void UXRInteractorComponent::RemoveOverlap(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+	int32* OverlapCount = OverlapCounts.Find(InComponent);
+	if (!OverlapCount)
+	{
+		return;
+	}
+	(*OverlapCount)--;
+	if (*OverlapCount <= 0)
+	{
+		OverlapCounts.Remove(InComponent);
+		OnComponentOverlapEnded(InComponent);
+	}
+}
+
+void UXRInteractorComponent::OnComponentOverlapStarted(UPrimitiveComponent* InComponent)
+{
+	InvalidateOverlappedInteractions();
+	if (DeferHoverToBatch())
+	{
+		return;
+	}
+	UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this);
+	if (!InteractionSubsystem)
+	{
+		return;
+	}
+	UXRInteractionSubsystem::FInteractionList Interactions;
+	InteractionSubsystem->GetInteractionsForComponent(InComponent, Interactions);
+	UXRInteractionComponent* PrioritizedInteraction = UXRToolsUtilityFunctions::GetXRInteractionByPriority(Interactions, this, 0, EXRInteractionPrioritySelection::LowerEqual);
+	if (PrioritizedInteraction)
+	{
+		RequestHover(PrioritizedInteraction, true);
+	}
+}
+
+void UXRInteractorComponent::OnComponentOverlapEnded(UPrimitiveComponent* InComponent)
+{
+	InvalidateOverlappedInteractions();
+	if (DeferHoverToBatch())
+	{
+		return;
+	}
+	UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(this);
+	if (!InteractionSubsystem)
+	{
+		return;
+	}
+	// Gathered into a copy, as hover callbacks may register / unregister Interactions while iterating
+	UXRInteractionSubsystem::FInteractionList Interactions;
+	InteractionSubsystem->GetInteractionsForComponent(InComponent, Interactions);
+	for (auto Interaction : Interactions)
+	{
+		RequestHover(Interaction, false);
+	}
+}
+
+// Seed the table from the current physics state, used whenever the set of listened colliders changes. 
+void UXRInteractorComponent::RebuildOverlapTable()
 {
-	TArray<UPrimitiveComponent*> RelevantColliders = AdditionalColliders;
-	if (!IgnoreSelf) { RelevantColliders.Add(this); }
-	for (UPrimitiveComponent* Collider : RelevantColliders)
+	TArray<UPrimitiveComponent*> OverlappingComps = {};
+	for (UPrimitiveComponent* Collider : GetOverlapEventColliders())
+	{
+		TArray<UPrimitiveComponent*> ColliderOverlappingComps = {};
+		Collider->GetOverlappingComponents(ColliderOverlappingComps);
+		OverlappingComps.Append(ColliderOverlappingComps);
+	}
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, int32> NewOverlapCounts = {};
+	for (UPrimitiveComponent* OverlappingComp : OverlappingComps)
 	{
-		if (Collider->IsOverlappingComponent(InComponent))
+		if (OverlappingComp)
 		{
-			return true;
+			NewOverlapCounts.FindOrAdd(OverlappingComp)++;
 		}
 	}
-	return false;
+	ApplyOverlapCounts(MoveTemp(NewOverlapCounts));
 }
 
-void UXRInteractorComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void UXRInteractorComponent::ApplyOverlapCounts(TMap<TWeakObjectPtr<UPrimitiveComponent>, int32>&& InOverlapCounts)
 {
-	if (!IsAnyColliderOverlappingComponent(OtherComp, true))
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, int32> PreviousOverlapCounts = MoveTemp(OverlapCounts);
+	OverlapCounts = MoveTemp(InOverlapCounts);
+
+	// Collect first, the callbacks may start / end Interactions and modify OverlapCounts
+	TArray<UPrimitiveComponent*, TInlineAllocator<8>> EndedComponents;
+	TArray<UPrimitiveComponent*, TInlineAllocator<8>> StartedComponents;
+	for (const auto& PreviousOverlap : PreviousOverlapCounts)
+	{
+		if (!OverlapCounts.Contains(PreviousOverlap.Key) && PreviousOverlap.Key.IsValid())
+		{
+			EndedComponents.Add(PreviousOverlap.Key.Get());
+		}
+	}
+	for (const auto& Overlap : OverlapCounts)
 	{
-		UXRInteractionComponent* PrioritizedInteraction = UXRToolsUtilityFunctions::GetXRInteractionByPriority(GetChildXRInteractionComponents(OtherComp), this, 0, EXRInteractionPrioritySelection::LowerEqual);
-		if (PrioritizedInteraction)
+		if (!PreviousOverlapCounts.Contains(Overlap.Key) && Overlap.Key.IsValid())
 		{
-			RequestHover(PrioritizedInteraction, true);
+			StartedComponents.Add(Overlap.Key.Get());
 		}
 	}
+
+	for (UPrimitiveComponent* EndedComponent : EndedComponents)
+	{
+		OnComponentOverlapEnded(EndedComponent);
+	}
+	for (UPrimitiveComponent* StartedComponent : StartedComponents)
+	{
+		OnComponentOverlapStarted(StartedComponent);
+	}
 }
 
-void UXRInteractorComponent::OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+// Batched Interactors only mark themselves dirty, the XRInteractorBatchSubsystem evaluates their hover state after physics
+bool UXRInteractorComponent::DeferHoverToBatch()
+{
+	if (!bUseBatchedHoverEvaluation)
+	{
+		return false;
+	}
+	UXRInteractorBatchSubsystem* BatchSubsystem = UXRInteractorBatchSubsystem::Get(this);
+	if (!BatchSubsystem)
+	{
+		return false;
+	}
+	BatchSubsystem->MarkHoverDirty(this);
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Proxy Sensors
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+TArray<UPrimitiveComponent*, TInlineAllocator<4>> UXRInteractorComponent::GetOverlapEventColliders()
+{
+	if (!IsOverlappingInteractionProxiesOnly())
+	{
+		return GetQueryColliders();
+	}
+	TArray<UPrimitiveComponent*, TInlineAllocator<4>> Sensors = {};
+	for (UShapeComponent* Sensor : ProxySensors)
+	{
+		if (Sensor)
+		{
+			Sensors.Add(Sensor);
+		}
+	}
+	return Sensors;
+}
+
+void UXRInteractorComponent::RebuildProxySensors()
+{
+	DestroyProxySensors();
+	for (UPrimitiveComponent* Collider : GetQueryColliders())
+	{
+		if (UShapeComponent* Sensor = CreateProxySensor(Collider))
+		{
+			ProxySensors.Add(Sensor);
+		}
+	}
+}
+
+void UXRInteractorComponent::DestroyProxySensors()
+{
+	for (UShapeComponent* Sensor : ProxySensors)
+	{
+		if (Sensor)
+		{
+			Sensor->DestroyComponent();
+		}
+	}
+	ProxySensors.Reset();
+}
+
+// Same setup as the Interaction proxies: query-only, overlapping only the proxy channel. The colliders own collision settings stay untouched.
+UShapeComponent* UXRInteractorComponent::CreateProxySensor(UPrimitiveComponent* InCollider)
+{
+	if (!InCollider || !GetOwner())
+	{
+		return nullptr;
+	}
+	const FCollisionShape Shape = InCollider->GetCollisionShape();
+	UShapeComponent* Sensor = nullptr;
+	switch (Shape.ShapeType)
+	{
+		case ECollisionShape::Sphere:
+		{
+			USphereComponent* Sphere = NewObject<USphereComponent>(GetOwner());
+			Sphere->InitSphereRadius(Shape.GetSphereRadius());
+			Sensor = Sphere;
+			break;
+		}
+		case ECollisionShape::Capsule:
+		{
+			UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(GetOwner());
+			Capsule->InitCapsuleSize(Shape.GetCapsuleRadius(), Shape.GetCapsuleHalfHeight());
+			Sensor = Capsule;
+			break;
+		}
+		case ECollisionShape::Box:
+		{
+			UBoxComponent* Box = NewObject<UBoxComponent>(GetOwner());
+			Box->InitBoxExtent(Shape.GetExtent());
+			Sensor = Box;
+			break;
+		}
+		default:
+			return nullptr;
+	}
+
+	// The collision shape is already scaled, inheriting the colliders scale would apply it twice
+	Sensor->SetupAttachment(InCollider);
+	Sensor->SetUsingAbsoluteScale(true);
+	Sensor->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	Sensor->SetCollisionObjectType(InteractionProxyChannel);
+	Sensor->SetCollisionResponseToAllChannels(ECR_Ignore);
+	Sensor->SetCollisionResponseToChannel(InteractionProxyChannel, ECR_Overlap);
+	Sensor->SetGenerateOverlapEvents(true);
+	Sensor->SetCanEverAffectNavigation(false);
+	Sensor->RegisterComponent();
+	Sensor->OnComponentBeginOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapBegin);
+	Sensor->OnComponentEndOverlap.AddDynamic(this, &UXRInteractorComponent::OnOverlapEnd);
+	return Sensor;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Async Query
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool UXRInteractorComponent::IsUsingAsyncQuery() const
+{
+	return QueryMode == EXRInteractorQueryMode::AsyncQuery;
+}
+
+ECollisionChannel UXRInteractorComponent::GetQueryChannel() const
+{
+	return IsOverlappingInteractionProxiesOnly() ? InteractionProxyChannel.GetValue() : QueryChannel.GetValue();
+}
+
+// An engine channel would be shared with regular geometry, defeating the point of the proxies
+bool UXRInteractorComponent::IsOverlappingInteractionProxiesOnly() const
+{
+	return bOverlapInteractionProxiesOnly && UXRToolsUtilityFunctions::IsProjectCollisionChannel(InteractionProxyChannel);
+}
+
+TArray<UPrimitiveComponent*, TInlineAllocator<4>> UXRInteractorComponent::GetQueryColliders()
+{
+	TArray<UPrimitiveComponent*, TInlineAllocator<4>> QueryColliders = {};
+	QueryColliders.Add(this);
+	for (UPrimitiveComponent* Collider : AdditionalColliders)
+	{
+		if (Collider)
+		{
+			QueryColliders.Add(Collider);
+		}
+	}
+	return QueryColliders;
+}
+
+void UXRInteractorComponent::RefreshOverlapsImmediate()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+	// Invalidate any in-flight async query, its results would be older than these
+	QuerySerial++;
+	PendingQueryResults = 0;
+	PendingQueryCounts.Reset();
+
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(XRInteractorQuery), false, GetOwner());
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, int32> NewOverlapCounts = {};
+	TArray<FOverlapResult> Overlaps = {};
+	for (UPrimitiveComponent* Collider : GetQueryColliders())
+	{
+		Overlaps.Reset();
+		World->OverlapMultiByChannel(Overlaps, Collider->GetComponentLocation(), Collider->GetComponentQuat(), GetQueryChannel(), Collider->GetCollisionShape(), QueryParams);
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			if (UPrimitiveComponent* OverlappedComponent = Overlap.GetComponent())
+			{
+				NewOverlapCounts.FindOrAdd(OverlappedComponent)++;
+			}
+		}
+	}
+	ApplyOverlapCounts(MoveTemp(NewOverlapCounts));
+}
+
+void UXRInteractorComponent::IssueAsyncOverlapQuery()
+{
+	UWorld* World = GetWorld();
+	// Skip while the previous query is still in flight
+	if (!World || PendingQueryResults > 0)
+	{
+		return;
+	}
+	QuerySerial++;
+	PendingQueryCounts.Reset();
+
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(XRInteractorAsyncQuery), false, GetOwner());
+	const TArray<UPrimitiveComponent*, TInlineAllocator<4>> QueryColliders = GetQueryColliders();
+	PendingQueryResults = QueryColliders.Num();
+	for (UPrimitiveComponent* Collider : QueryColliders)
+	{
+		World->AsyncOverlapByChannel(Collider->GetComponentLocation(), Collider->GetComponentQuat(), GetQueryChannel(), Collider->GetCollisionShape(),
+			QueryParams, FCollisionResponseParams::DefaultResponseParam, &AsyncOverlapDelegate, QuerySerial);
+	}
+}
+
+void UXRInteractorComponent::OnAsyncOverlapQueryCompleted(const FTraceHandle& InTraceHandle, FOverlapDatum& InOverlapDatum)
 {
-	if (!IsAnyColliderOverlappingComponent(OtherComp, true))
+	if (InOverlapDatum.UserData != QuerySerial)
 	{
-		for (auto Interaction : GetChildXRInteractionComponents(OtherComp))
+		return;
+	}
+	for (const FOverlapResult& Overlap : InOverlapDatum.OutOverlaps)
+	{
+		if (UPrimitiveComponent* OverlappedComponent = Overlap.GetComponent())
 		{
-			RequestHover(Interaction, false);
+			PendingQueryCounts.FindOrAdd(OverlappedComponent)++;
 		}
 	}
+	PendingQueryResults--;
+	if (PendingQueryResults == 0)
+	{
+		ApplyOverlapCounts(MoveTemp(PendingQueryCounts));
+		PendingQueryCounts.Reset();
+	}
 }
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -319,25 +1049,28 @@ void UXRInteractorComponent::OnOverlapEnd(UPrimitiveComponent* OverlappedComp, A
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 void UXRInteractorComponent::RequestHover(UXRInteractionComponent* InInteraction, bool bInHoverState)
 {
-	if (!InInteraction)
+	const FXRInteractionHandle Handle = InInteraction ? InInteraction->GetInteractionHandle() : FXRInteractionHandle();
+	if (!Handle.IsValid())
 	{
 		return;
 	}
 	if (bInHoverState)
 	{
-		if (!HoveredInteractionComponents.Contains(InInteraction))
+		if (!HoveredInteractionHandles.Contains(Handle))
 		{
-			HoveredInteractionComponents.Add(InInteraction);
+			HoveredInteractionHandles.Add(Handle);
 			InInteraction->HoverInteraction(this, true);
+			OnHoverStateChangedNative.Broadcast(this, InInteraction, true);
 			OnHoverStateChanged.Broadcast(this, InInteraction, true);
 		}
 	}
 	if (!bInHoverState)
 	{
-		if (HoveredInteractionComponents.Contains(InInteraction))
+		if (HoveredInteractionHandles.Contains(Handle))
 		{
-			HoveredInteractionComponents.Remove(InInteraction);
+			HoveredInteractionHandles.Remove(Handle);
 			InInteraction->HoverInteraction(this, false);
+			OnHoverStateChangedNative.Broadcast(this, InInteraction, false);
 			OnHoverStateChanged.Broadcast(this, InInteraction, false);
 		}
 	}
@@ -349,7 +1082,19 @@ void UXRInteractorComponent::RequestHover(UXRInteractionComponent* InInteraction
 // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 bool UXRInteractorComponent::IsInteracting() const
 {
-	return !ActiveInteractionComponents.IsEmpty();
+	if (!PredictedInteractions.IsEmpty())
+	{
+		return true;
+	}
+	// Interactions stopped locally are no longer active, even while their removal has not replicated yet
+	for (const FXRActiveInteractionItem& ActiveInteraction : ActiveInteractionComponents.Items)
+	{
+		if (!PredictedStops.Contains(ActiveInteraction.Interaction))
+		{
+			return true;
+		}
+	}
+	return false;
 }
 
 void UXRInteractorComponent::Server_SetXRControllerHand_Implementation(EControllerHand InXRControllerHand)
@@ -365,21 +1110,39 @@ EControllerHand UXRInteractorComponent::GetXRControllerHand() const
 TArray<UXRInteractionComponent*> UXRInteractorComponent::GetActiveInteractions() const
 {
 	TArray<UXRInteractionComponent*> OutInteractions = {};
-	for (auto ActiveInteraction : ActiveInteractionComponents)
+	for (const FXRActiveInteractionItem& ActiveInteraction : ActiveInteractionComponents.Items)
+	{
+		if (IsValid(ActiveInteraction.Interaction) && !PredictedStops.Contains(ActiveInteraction.Interaction))
+		{
+			OutInteractions.AddUnique(ActiveInteraction.Interaction);
+		}
+	}
+	// Locally predicted Interactions are active on the owning client until the server rejects them
+	for (const auto& PredictedInteraction : PredictedInteractions)
 	{
-		if (ActiveInteraction.IsValid())
+		if (PredictedInteraction.Key.IsValid())
 		{
-			OutInteractions.AddUnique(ActiveInteraction.Get());
+			OutInteractions.AddUnique(PredictedInteraction.Key.Get());
 		}
 	}
 	return OutInteractions;
 }
 
-bool UXRInteractorComponent::IsLaserInteractor()
+bool UXRInteractorComponent::IsLaserInteractor() const
 {
 	return bIsLaserInteractor;
 }
 
+FXRInteractorHandle UXRInteractorComponent::GetInteractorHandle() const
+{
+	return InteractorHandle;
+}
+
+void UXRInteractorComponent::RemoveHoveredInteraction(const FXRInteractionHandle& InInteractionHandle)
+{
+	HoveredInteractionHandles.Remove(InInteractionHandle);
+}
+
 bool UXRInteractorComponent::IsLocallyControlled() const
 {
 	return bIsLocallyControlled;
@@ -21,6 +21,7 @@ void UXRLaserComponent::BeginPlay()
 	if (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer || NetMode == NM_Standalone)
 	{
 		bool SpawnResult = SpawnXRLaserActor();
+		OnXRLaserSpawnedNative.Broadcast(this, SpawnResult);
 		OnXRLaserSpawned.Broadcast(this, SpawnResult);
 	}
 }
@@ -180,6 +181,7 @@ void UXRLaserComponent::Multicast_SetLaserActive_Implementation(bool bInActive)
 
 void UXRLaserComponent::OnRep_IsLaserActive()
 {
+	OnXRLaserStateChangedNative.Broadcast(this, bIsLaserActive);
 	OnXRLaserStateChanged.Broadcast(this, bIsLaserActive);
 }
 
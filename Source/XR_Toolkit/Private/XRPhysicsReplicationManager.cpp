@@ -0,0 +1,140 @@
+#include "XRPhysicsReplicationManager.h"
+#include "XRPhysicsReplicationSubsystem.h"
+#include "Net/UnrealNetwork.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SceneComponent.h"
+
+AXRPhysicsReplicationManager::AXRPhysicsReplicationManager()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	// Placed region managers are relevant within NetCullDistanceSquared of their location, the per level default managers are made always relevant on spawn
+	bAlwaysRelevant = false;
+	SetReplicatingMovement(false);
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void AXRPhysicsReplicationManager::AddBody(UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot)
+{
+	Bodies.AddBody(InBody, InSnapshot);
+}
+
+void AXRPhysicsReplicationManager::RemoveBody(const UXRReplicatedPhysicsComponent* InBody)
+{
+	Bodies.RemoveBody(InBody);
+}
+
+void AXRPhysicsReplicationManager::UpdateBody(const UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot)
+{
+	Bodies.UpdateBody(InBody, InSnapshot);
+}
+
+const FXRPhysicsSnapshot* AXRPhysicsReplicationManager::FindSnapshot(const UXRReplicatedPhysicsComponent* InBody) const
+{
+	return Bodies.FindSnapshot(InBody);
+}
+
+void AXRPhysicsReplicationManager::SetConnectionOwner(APlayerController* InPlayerController)
+{
+	SetOwner(InPlayerController);
+	bAlwaysRelevant = false;
+	bOnlyRelevantToOwner = true;
+}
+
+bool AXRPhysicsReplicationManager::HasUnsentChanges() const
+{
+	return Bodies.HasUnsentChanges();
+}
+
+int32 AXRPhysicsReplicationManager::GetNumBodies() const
+{
+	return Bodies.Num();
+}
+
+void AXRPhysicsReplicationManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(AXRPhysicsReplicationManager, Bodies);
+}
+
+void AXRPhysicsReplicationManager::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	if (bOnlyRelevantToOwner && HasAuthority())
+	{
+		if (UXRPhysicsReplicationSubsystem* PhysicsReplicationSubsystem = UXRPhysicsReplicationSubsystem::Get(this))
+		{
+			PhysicsReplicationSubsystem->ScheduleManager(this);
+		}
+	}
+	Super::PreReplication(ChangedPropertyTracker);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Bodies
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void FXRPhysicsBodyItem::PostReplicatedAdd(const FXRPhysicsBodyArray& InArraySerializer)
+{
+	// Null until the bodies level is loaded on this client, applied once it resolves
+	if (Body)
+	{
+		Body->ReceiveSnapshot(Snapshot);
+	}
+}
+
+void FXRPhysicsBodyItem::PostReplicatedChange(const FXRPhysicsBodyArray& InArraySerializer)
+{
+	PostReplicatedAdd(InArraySerializer);
+}
+
+bool FXRPhysicsBodyArray::AddBody(UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot)
+{
+	if (!InBody || ItemIndices.Contains(InBody))
+	{
+		return false;
+	}
+	ItemIndices.Add(InBody, Items.Num());
+	FXRPhysicsBodyItem& Item = Items.AddDefaulted_GetRef();
+	Item.Body = InBody;
+	Item.Snapshot = InSnapshot;
+	MarkItemDirty(Item);
+	bHasUnsentChanges = true;
+	return true;
+}
+
+bool FXRPhysicsBodyArray::UpdateBody(const UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot)
+{
+	const int32* Index = ItemIndices.Find(InBody);
+	if (!Index)
+	{
+		return false;
+	}
+	FXRPhysicsBodyItem& Item = Items[*Index];
+	Item.Snapshot = InSnapshot;
+	MarkItemDirty(Item);
+	bHasUnsentChanges = true;
+	return true;
+}
+
+bool FXRPhysicsBodyArray::RemoveBody(const UXRReplicatedPhysicsComponent* InBody)
+{
+	int32 Index = INDEX_NONE;
+	if (!ItemIndices.RemoveAndCopyValue(InBody, Index))
+	{
+		return false;
+	}
+	Items.RemoveAtSwap(Index);
+	// Fix up the index of the item that was swapped into the removed slot
+	if (Items.IsValidIndex(Index))
+	{
+		ItemIndices.Add(Items[Index].Body, Index);
+	}
+	MarkArrayDirty();
+	bHasUnsentChanges = true;
+	return true;
+}
+
+const FXRPhysicsSnapshot* FXRPhysicsBodyArray::FindSnapshot(const UXRReplicatedPhysicsComponent* InBody) const
+{
+	const int32* Index = ItemIndices.Find(InBody);
+	return Index ? &Items[*Index].Snapshot : nullptr;
+}
@@ -0,0 +1,373 @@
+#include "XRPhysicsReplicationSubsystem.h"
+#include "XRPhysicsReplicationManager.h"
+#include "XRReplicatedPhysicsComponent.h"
+#include "XRInteractorComponent.h"
+#include "XRCoreSettings.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+
+void UXRPhysicsReplicationSubsystem::Deinitialize()
+{
+	Bodies.Empty();
+	LevelManagers.Empty();
+	Connections.Empty();
+	Candidates.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UXRPhysicsReplicationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UXRPhysicsReplicationSubsystem, STATGROUP_Tickables);
+}
+
+UXRPhysicsReplicationSubsystem* UXRPhysicsReplicationSubsystem::Get(const UObject* InWorldContextObject)
+{
+	if (!InWorldContextObject)
+	{
+		return nullptr;
+	}
+	UWorld* World = InWorldContextObject->GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+	return World->GetSubsystem<UXRPhysicsReplicationSubsystem>();
+}
+
+bool UXRPhysicsReplicationSubsystem::IsServer() const
+{
+	return GetWorld() && GetWorld()->GetNetMode() != NM_Client;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Bodies
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+bool UXRPhysicsReplicationSubsystem::RegisterBody(UXRReplicatedPhysicsComponent* InBody)
+{
+	if (!InBody || !InBody->GetOwner())
+	{
+		return false;
+	}
+	FRegisteredBody RegisteredBody;
+	RegisteredBody.Body = InBody;
+	// Full path plus one NetGUID per outer, only the per connection scheduler charges it
+	RegisteredBody.ReferenceExportBits = (InBody->GetPathName().Len() + 24) * 8;
+	// Scheduled bodies are added to each connections manager once they are first sent
+	if (IsServer() && !GetDefault<UXRCoreSettings>()->bSchedulePhysicsPerConnection)
+	{
+		AXRPhysicsReplicationManager* Manager = InBody->ReplicationManager;
+		if (!Manager)
+		{
+			Manager = FindOrSpawnLevelManager(InBody->GetOwner()->GetLevel());
+		}
+		if (!Manager)
+		{
+			return false;
+		}
+		Manager->AddBody(InBody, InBody->LatestSnapshot);
+		RegisteredBody.Manager = Manager;
+	}
+	Bodies.Add(RegisteredBody);
+	return true;
+}
+
+void UXRPhysicsReplicationSubsystem::UnregisterBody(UXRReplicatedPhysicsComponent* InBody)
+{
+	const int32 Index = Bodies.IndexOfByPredicate([InBody](const FRegisteredBody& RegisteredBody) { return RegisteredBody.Body == InBody; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+	if (AXRPhysicsReplicationManager* Manager = Bodies[Index].Manager.Get())
+	{
+		Manager->RemoveBody(InBody);
+	}
+	Bodies.RemoveAtSwap(Index);
+
+	for (FConnectionSchedule& Connection : Connections)
+	{
+		if (AXRPhysicsReplicationManager* Manager = Connection.Manager.Get())
+		{
+			Manager->RemoveBody(InBody);
+		}
+		Connection.Priorities.Remove(InBody);
+	}
+}
+
+AXRPhysicsReplicationManager* UXRPhysicsReplicationSubsystem::FindOrSpawnLevelManager(ULevel* InLevel)
+{
+	UWorld* World = GetWorld();
+	if (!World || !InLevel)
+	{
+		return nullptr;
+	}
+	if (AXRPhysicsReplicationManager* Manager = LevelManagers.FindRef(InLevel).Get())
+	{
+		return Manager;
+	}
+	// Spawned into the bodies level, so it streams out together with them
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.OverrideLevel = InLevel;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	AXRPhysicsReplicationManager* Manager = World->SpawnActor<AXRPhysicsReplicationManager>(SpawnParameters);
+	if (Manager)
+	{
+		// Covers the whole level
+		Manager->bAlwaysRelevant = true;
+	}
+	LevelManagers.Add(InLevel, Manager);
+	return Manager;
+}
+
+void UXRPhysicsReplicationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const bool bIsServer = IsServer();
+	if (bIsServer && GetDefault<UXRCoreSettings>()->bSchedulePhysicsPerConnection)
+	{
+		TickScheduler(DeltaTime);
+		return;
+	}
+
+	for (int32 BodyIndex = Bodies.Num() - 1; BodyIndex >= 0; BodyIndex--)
+	{
+		UXRReplicatedPhysicsComponent* Body = Bodies[BodyIndex].Body.Get();
+		if (!Body)
+		{
+			Bodies.RemoveAtSwap(BodyIndex);
+			continue;
+		}
+		if (!Body->IsActive() || !Body->GetOwner())
+		{
+			continue;
+		}
+
+		if (!bIsServer)
+		{
+			Body->ClientTick(DeltaTime);
+			continue;
+		}
+		// Only bodies that took a new Snapshot are marked dirty
+		const uint16 PreviousID = Body->LatestSnapshot.ID;
+		Body->ServerTick(DeltaTime);
+		if (Body->LatestSnapshot.ID != PreviousID)
+		{
+			if (AXRPhysicsReplicationManager* Manager = Bodies[BodyIndex].Manager.Get())
+			{
+				Manager->UpdateBody(Body, Body->LatestSnapshot);
+			}
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Per Connection Scheduler
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void UXRPhysicsReplicationSubsystem::TickScheduler(float DeltaTime)
+{
+	// Snapshots are only captured at the rate the managers replicate, the batches are filled in ScheduleManager
+	SchedulerAccumulatedTime += DeltaTime;
+	if (SchedulerAccumulatedTime < 1.0f / FMath::Max(GetDefault<UXRCoreSettings>()->PhysicsSchedulerRate, 1.0f))
+	{
+		return;
+	}
+	SchedulerAccumulatedTime = 0.0f;
+
+	for (int32 BodyIndex = Bodies.Num() - 1; BodyIndex >= 0; BodyIndex--)
+	{
+		UXRReplicatedPhysicsComponent* Body = Bodies[BodyIndex].Body.Get();
+		if (!Body)
+		{
+			Bodies.RemoveAtSwap(BodyIndex);
+			continue;
+		}
+		if (Body->IsActive() && Body->GetOwner())
+		{
+			Body->CaptureSnapshot();
+		}
+	}
+
+	UpdateConnections();
+}
+
+void UXRPhysicsReplicationSubsystem::ScheduleManager(AXRPhysicsReplicationManager* InManager)
+{
+	FConnectionSchedule* Connection = Connections.FindByPredicate([InManager](const FConnectionSchedule& Schedule) { return Schedule.Manager == InManager; });
+	// The previous batch is still waiting (iE. the connection was saturated), adding to it would exceed the budget of a single net update
+	if (!Connection || InManager->HasUnsentChanges())
+	{
+		return;
+	}
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float ElapsedTime = static_cast<float>(Now - Connection->LastScheduleTime);
+	Connection->LastScheduleTime = Now;
+	ScheduleConnection(*Connection, ElapsedTime);
+}
+
+void UXRPhysicsReplicationSubsystem::UpdateConnections()
+{
+	Connections.RemoveAllSwap([](const FConnectionSchedule& Connection)
+	{
+		if (Connection.PlayerController.IsValid())
+		{
+			return false;
+		}
+		if (AXRPhysicsReplicationManager* Manager = Connection.Manager.Get())
+		{
+			Manager->Destroy();
+		}
+		return true;
+	});
+
+	UWorld* World = GetWorld();
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = Iterator->Get();
+		// Local players see the simulated bodies directly
+		if (!PlayerController || PlayerController->IsLocalController())
+		{
+			continue;
+		}
+		if (Connections.ContainsByPredicate([PlayerController](const FConnectionSchedule& Connection) { return Connection.PlayerController == PlayerController; }))
+		{
+			continue;
+		}
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Owner = PlayerController;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+		AXRPhysicsReplicationManager* Manager = World->SpawnActor<AXRPhysicsReplicationManager>(SpawnParameters);
+		if (!Manager)
+		{
+			continue;
+		}
+		Manager->SetConnectionOwner(PlayerController);
+		Manager->NetUpdateFrequency = GetDefault<UXRCoreSettings>()->PhysicsSchedulerRate;
+
+		FConnectionSchedule& Connection = Connections.AddDefaulted_GetRef();
+		Connection.PlayerController = PlayerController;
+		Connection.Manager = Manager;
+		Connection.LastScheduleTime = World->GetTimeSeconds();
+	}
+}
+
+void UXRPhysicsReplicationSubsystem::ScheduleConnection(FConnectionSchedule& InOutConnection, float InElapsedTime)
+{
+	// Fast array item handle and the NetGUID of the already exported body reference
+	constexpr int32 ItemOverheadBits = 64;
+	// Bodies the connection never received go first, closest ones before others
+	constexpr float UnsentPriority = 1.0e6f;
+
+	const APlayerController* PlayerController = InOutConnection.PlayerController.Get();
+	AXRPhysicsReplicationManager* Manager = InOutConnection.Manager.Get();
+	if (!PlayerController || !Manager)
+	{
+		return;
+	}
+	const UXRCoreSettings* Settings = GetDefault<UXRCoreSettings>();
+
+	TArray<FVector, TInlineAllocator<3>> ViewerLocations;
+	GetViewerLocations(PlayerController, ViewerLocations);
+
+	Candidates.Reset();
+	for (const FRegisteredBody& RegisteredBody : Bodies)
+	{
+		UXRReplicatedPhysicsComponent* Body = RegisteredBody.Body.Get();
+		if (!Body || !Body->IsActive() || !Body->GetOwner())
+		{
+			continue;
+		}
+		const FXRPhysicsSnapshot& Snapshot = Body->LatestSnapshot;
+		const FXRPhysicsSnapshot* SentSnapshot = Manager->FindSnapshot(Body);
+		float& Priority = InOutConnection.Priorities.FindOrAdd(Body);
+		if (SentSnapshot && SentSnapshot->ID == Snapshot.ID)
+		{
+			Priority = 0.0f;
+			continue;
+		}
+
+		float MinDistanceSquared = UE_MAX_FLT;
+		for (const FVector& ViewerLocation : ViewerLocations)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(ViewerLocation, Snapshot.Location));
+		}
+		const float DistanceScale = ViewerLocations.Num() > 0 ? 1.0f / (1.0f + FMath::Sqrt(MinDistanceSquared) / Settings->PhysicsPriorityDistanceFalloff) : 1.0f;
+
+		if (!SentSnapshot)
+		{
+			Priority = UnsentPriority * DistanceScale;
+		}
+		else
+		{
+			// Error of the connections extrapolation of what it was last sent
+			FVector PredictedLocation;
+			FQuat PredictedRotation;
+			Body->ExtrapolateSnapshot(*SentSnapshot, Snapshot.ServerTime, PredictedLocation, PredictedRotation);
+			const float Error = FVector::Dist(PredictedLocation, Snapshot.Location) + FMath::RadiansToDegrees(PredictedRotation.AngularDistance(Snapshot.Rotation.Quaternion()));
+
+			float Weight = (1.0f + Error * Settings->PhysicsPriorityErrorScale) * DistanceScale;
+			if (Snapshot.bIsInteractedWith)
+			{
+				Weight *= Settings->PhysicsPriorityInteractedScale;
+			}
+			Priority += Weight * InElapsedTime;
+		}
+
+		FScheduleCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+		Candidate.Body = Body;
+		Candidate.Priority = Priority;
+		Candidate.Bits = Snapshot.GetNetSerializedBits() + ItemOverheadBits + (SentSnapshot ? 0 : RegisteredBody.ReferenceExportBits);
+	}
+
+	Candidates.Sort([](const FScheduleCandidate& A, const FScheduleCandidate& B) { return A.Priority > B.Priority; });
+
+	const int32 BudgetBits = Settings->PhysicsBytesPerUpdate * 8;
+	int32 RemainingBits = BudgetBits;
+	for (FScheduleCandidate& Candidate : Candidates)
+	{
+		const FXRPhysicsSnapshot& Snapshot = Candidate.Body->LatestSnapshot;
+		// Smaller Snapshots (iE. of resting bodies) may still fit. A single item larger than the whole budget is sent alone, so it is never starved.
+		if (Candidate.Bits > RemainingBits && RemainingBits < BudgetBits)
+		{
+			continue;
+		}
+		RemainingBits -= Candidate.Bits;
+		if (Manager->FindSnapshot(Candidate.Body))
+		{
+			Manager->UpdateBody(Candidate.Body, Snapshot);
+		}
+		else
+		{
+			Manager->AddBody(Candidate.Body, Snapshot);
+		}
+		Candidate.bSent = true;
+	}
+
+	for (const FScheduleCandidate& Candidate : Candidates)
+	{
+		if (Candidate.bSent)
+		{
+			InOutConnection.Priorities.Add(Candidate.Body, 0.0f);
+		}
+	}
+}
+
+void UXRPhysicsReplicationSubsystem::GetViewerLocations(const APlayerController* InPlayerController, TArray<FVector, TInlineAllocator<3>>& OutLocations)
+{
+	FVector HeadLocation;
+	FRotator HeadRotation;
+	InPlayerController->GetPlayerViewPoint(HeadLocation, HeadRotation);
+	OutLocations.Add(HeadLocation);
+
+	// The players hands
+	if (const APawn* Pawn = InPlayerController->GetPawn())
+	{
+		TInlineComponentArray<UXRInteractorComponent*> Interactors(Pawn);
+		for (const UXRInteractorComponent* Interactor : Interactors)
+		{
+			OutLocations.Add(Interactor->GetComponentLocation());
+		}
+	}
+}
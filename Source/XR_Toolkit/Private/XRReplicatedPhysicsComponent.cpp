@@ -1,6 +1,10 @@
 #include "XRReplicatedPhysicsComponent.h"
 #include "XRCoreSettings.h"
+#include "XRPhysicsReplicationSubsystem.h"
+#include "XR_Toolkit.h"
 #include "Net/UnrealNetwork.h"
+#include "GameFramework/GameStateBase.h"
+#include "Components/PrimitiveComponent.h"
 
 UXRReplicatedPhysicsComponent::UXRReplicatedPhysicsComponent()
 {
@@ -22,30 +26,74 @@ void UXRReplicatedPhysicsComponent::BeginPlay()
 	}
 
 	RegisterPhysicsMeshComponents(RegisterMeshComponentsWithTag);
-	if (GetOwnerRole() == ROLE_Authority )
+	if (HasPhysicsAuthority())
 	{
-		FXRPhysicsSnapshot NewSnapshot;
+		FXRPhysicsSnapshot NewSnapshot = MakeSnapshot();
 		NewSnapshot.ID = 1;
-		NewSnapshot.Location = GetOwner()->GetActorLocation();
-		NewSnapshot.Rotation = GetOwner()->GetActorRotation();
 		NewSnapshot.bIsInteractedWith = false;
+		NewSnapshot.bIsAtRest = true;
 		LatestSnapshot = NewSnapshot;
-		Server_SetCachedSnapshot(NewSnapshot);
 		SetSimulatePhysicsOnOwner(true);
 	}
+
+	// Clients resolve the body by its path, which only level loaded Actors have without replicating
+	if (bUseReplicationManager && GetNetMode() != NM_Standalone && IsNameStableForNetworking())
+	{
+		if (UXRPhysicsReplicationSubsystem* PhysicsReplicationSubsystem = UXRPhysicsReplicationSubsystem::Get(this))
+		{
+			bRegisteredWithManager = PhysicsReplicationSubsystem->RegisterBody(this);
+		}
+	}
+	if (bRegisteredWithManager)
+	{
+		// The subsystem ticks the body and the manager replicates its Snapshots
+		SetIsReplicated(false);
+		SetComponentTickEnabled(false);
+	}
+	else if (bUseReplicationManager && GetNetMode() != NM_Standalone)
+	{
+		UE_LOG(LogXRToolkit, Warning, TEXT("%s: Not replicated through an XRPhysicsReplicationManager (only Actors loaded with the level can be), falling back to component replication."), *GetPathName());
+		if (HasPhysicsAuthority())
+		{
+			GetOwner()->SetReplicates(true);
+		}
+	}
 	
     FTimerHandle TimerHandle;
     GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &UXRReplicatedPhysicsComponent::DelayedPhysicsSetup, 0.5f, false);
 }
 
+void UXRReplicatedPhysicsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRegisteredWithManager)
+	{
+		if (UXRPhysicsReplicationSubsystem* PhysicsReplicationSubsystem = UXRPhysicsReplicationSubsystem::Get(this))
+		{
+			PhysicsReplicationSubsystem->UnregisterBody(this);
+		}
+		bRegisteredWithManager = false;
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
 void UXRReplicatedPhysicsComponent::DelayedPhysicsSetup()
 {
 	if (bAutoActivate)
 	{
-		SetSimulatePhysicsOnOwner(GetOwnerRole() == ROLE_Authority);
+		SetSimulatePhysicsOnOwner(HasPhysicsAuthority());
 	}
 }
 
+bool UXRReplicatedPhysicsComponent::HasPhysicsAuthority() const
+{
+	return GetOwnerRole() == ROLE_Authority && GetNetMode() != NM_Client;
+}
+
+bool UXRReplicatedPhysicsComponent::IsUsingReplicationManager() const
+{
+	return bRegisteredWithManager;
+}
+
 void UXRReplicatedPhysicsComponent::OnRegister()
 {
 	Super::OnRegister();
@@ -74,8 +122,13 @@ void UXRReplicatedPhysicsComponent::TickComponent(float DeltaTime, ELevelTick Ti
 	{
 		return;
 	}
+	if (bRegisteredWithManager)
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
 
-	if (GetOwnerRole() == ROLE_Authority)
+	if (HasPhysicsAuthority())
 	{
 		ServerTick(DeltaTime);
 	}
@@ -88,13 +141,65 @@ void UXRReplicatedPhysicsComponent::TickComponent(float DeltaTime, ELevelTick Ti
 // -----------------------------------------------------------------------------------------------------------------------------------
 // State
 // -----------------------------------------------------------------------------------------------------------------------------------
-void UXRReplicatedPhysicsComponent::OnRep_CachedSnapshot()
+void UXRReplicatedPhysicsComponent::ReceiveSnapshot(const FXRPhysicsSnapshot& InSnapshot)
+{
+	LatestSnapshot = InSnapshot;
+	OnRep_LatestSnapshot();
+}
+
+void UXRReplicatedPhysicsComponent::OnRep_LatestSnapshot()
+{
+	if (HasPhysicsAuthority())
+	{
+		return;
+	}
+	bHasReceivedSnapshot = true;
+	if (SmoothingMode == EXRPhysicsSmoothingMode::DeadReckoning)
+	{
+		// Rest Snapshots are blended in as well, they simply extrapolate to themselves
+		BeginCorrection();
+	}
+	// Rest Snapshots are buffered like any other, ClientTickBuffered reaches them at their own server time
+	BufferSnapshot(LatestSnapshot);
+}
+
+double UXRReplicatedPhysicsComponent::GetServerTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+	// Approximated on clients by the GameState, which keeps the clock in sync with the server
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+	return World->GetTimeSeconds();
+}
+
+FXRPhysicsSnapshot UXRReplicatedPhysicsComponent::MakeSnapshot() const
 {
-	LatestSnapshot = CachedSnapshot;
-	if (GetOwnerRole() != ROLE_Authority)
+	FXRPhysicsSnapshot NewSnapshot;
+	NewSnapshot.ID = LatestSnapshot.ID + 1;
+	NewSnapshot.Location = GetOwner()->GetActorLocation();
+	NewSnapshot.Rotation = GetOwner()->GetActorRotation();
+	NewSnapshot.bIsInteractedWith = bIsInteractedWith;
+	NewSnapshot.ServerTime = GetServerTime();
+
+	UPrimitiveComponent* PhysicsBody = RegisteredMeshComponents.Num() > 0 ? RegisteredMeshComponents[0] : Cast<UPrimitiveComponent>(GetOwner()->GetRootComponent());
+	if (PhysicsBody && PhysicsBody->IsSimulatingPhysics())
+	{
+		NewSnapshot.LinearVelocity = PhysicsBody->GetPhysicsLinearVelocity();
+		NewSnapshot.AngularVelocity = PhysicsBody->GetPhysicsAngularVelocityInDegrees();
+		// Held bodies are carried by their XRInteractor, gravity does not move them
+		NewSnapshot.bIsGravityEnabled = PhysicsBody->IsGravityEnabled() && !bIsInteractedWith;
+	}
+	else
 	{
-		GetOwner()->SetActorLocationAndRotation(CachedSnapshot.Location, CachedSnapshot.Rotation);
+		NewSnapshot.LinearVelocity = GetOwner()->GetVelocity();
 	}
+	return NewSnapshot;
 }
 
 FXRPhysicsSnapshot UXRReplicatedPhysicsComponent::GetLatestSnapshot() const
@@ -104,7 +209,11 @@ FXRPhysicsSnapshot UXRReplicatedPhysicsComponent::GetLatestSnapshot() const
 
 void UXRReplicatedPhysicsComponent::OnActivated(UActorComponent* Component, bool bReset)
 {
-	SetSimulatePhysicsOnOwner(GetOwnerRole() == ROLE_Authority);
+	SetSimulatePhysicsOnOwner(HasPhysicsAuthority());
+	if (bRegisteredWithManager)
+	{
+		SetComponentTickEnabled(false);
+	}
 }
 
 void UXRReplicatedPhysicsComponent::OnDeactivated(UActorComponent* Component)
@@ -123,39 +232,60 @@ void UXRReplicatedPhysicsComponent::ServerTick(float DeltaTime)
 	}
 
 	// Do not replicate static objects
-	if (GetActorVelocity() < 0.0001f && !bIsInteractedWith)
+	if (IsAtRest())
 	{
 		// Replicate only one time, when the object becomes static
-		if (CachedSnapshot.Location != GetOwner()->GetActorLocation())
-		{
-			FXRPhysicsSnapshot NewSnapshot;
-			NewSnapshot.ID = 0;
-			NewSnapshot.Location = GetOwner()->GetActorLocation();
-			NewSnapshot.Rotation = GetOwner()->GetActorRotation();
-			NewSnapshot.bIsInteractedWith = false;
-			Server_SetCachedSnapshot(NewSnapshot);
-		}
+		CaptureSnapshot();
 		return;
 	}
 
 	float ReplicationInterval = LatestSnapshot.bIsInteractedWith != 0 ? InteractedReplicationInterval : DefaultReplicationInterval;
 	AccumulatedTime += DeltaTime;
-	if (AccumulatedTime >= ReplicationInterval)
+	if (AccumulatedTime < ReplicationInterval)
 	{
-		FXRPhysicsSnapshot NewSnapshot;
-		NewSnapshot.ID = LatestSnapshot.ID + 1;
-		NewSnapshot.Location = GetOwner()->GetActorLocation();
-		NewSnapshot.Rotation = GetOwner()->GetActorRotation();
-		NewSnapshot.bIsInteractedWith = bIsInteractedWith;
+		return;
+	}
 
-		LatestSnapshot = NewSnapshot;
-		AccumulatedTime = 0.0f;
+	if (SmoothingMode == EXRPhysicsSmoothingMode::DeadReckoning && !LatestSnapshot.bIsAtRest && LatestSnapshot.bIsInteractedWith == bIsInteractedWith)
+	{
+		// Only send once the clients extrapolation of the latest Snapshot drifts too far from the simulated pose
+		FVector PredictedLocation;
+		FQuat PredictedRotation;
+		ExtrapolateSnapshot(LatestSnapshot, GetServerTime(), PredictedLocation, PredictedRotation);
+		const float PositionError = FVector::Dist(PredictedLocation, GetOwner()->GetActorLocation());
+		const float RotationError = FMath::RadiansToDegrees(PredictedRotation.AngularDistance(GetOwner()->GetActorQuat()));
+		if (PositionError <= PositionErrorThreshold && RotationError <= RotationErrorThreshold)
+		{
+			return;
+		}
 	}
+
+	LatestSnapshot = MakeSnapshot();
+	AccumulatedTime = 0.0f;
+}
+
+bool UXRReplicatedPhysicsComponent::IsAtRest() const
+{
+	return GetActorVelocity() < 0.0001f && !bIsInteractedWith;
 }
 
-void UXRReplicatedPhysicsComponent::Server_SetCachedSnapshot_Implementation(FXRPhysicsSnapshot InCachedSnapshot)
+void UXRReplicatedPhysicsComponent::CaptureSnapshot()
 {
-	CachedSnapshot = InCachedSnapshot;
+	if (!IsAtRest())
+	{
+		LatestSnapshot = MakeSnapshot();
+		return;
+	}
+	if (!LatestSnapshot.bIsAtRest || LatestSnapshot.Location != GetOwner()->GetActorLocation())
+	{
+		FXRPhysicsSnapshot NewSnapshot = MakeSnapshot();
+		NewSnapshot.bIsInteractedWith = false;
+		NewSnapshot.bIsAtRest = true;
+		NewSnapshot.bIsGravityEnabled = false;
+		NewSnapshot.LinearVelocity = FVector::ZeroVector;
+		NewSnapshot.AngularVelocity = FVector::ZeroVector;
+		LatestSnapshot = NewSnapshot;
+	}
 }
 
 void UXRReplicatedPhysicsComponent::SetInteractedWith(bool bInInteracedWith)
@@ -173,12 +303,33 @@ bool UXRReplicatedPhysicsComponent::GetInteractedWith() const
 // -----------------------------------------------------------------------------------------------------------------------------------
 void UXRReplicatedPhysicsComponent::ClientTick(float DeltaTime)
 {
+	// Bodies replicated through a manager have no initial Snapshot, their Actor is loaded with the level
+	if (!bHasReceivedSnapshot)
+	{
+		return;
+	}
 	if (bDebugDisableClientInterpolation)
 	{
 		GetOwner()->SetActorLocationAndRotation(LatestSnapshot.Location, LatestSnapshot.Rotation);
 		return;
 	}
 
+	switch (SmoothingMode)
+	{
+		case EXRPhysicsSmoothingMode::Buffered:
+			ClientTickBuffered(DeltaTime);
+			break;
+		case EXRPhysicsSmoothingMode::DeadReckoning:
+			ClientTickDeadReckoning(DeltaTime);
+			break;
+		default:
+			ClientTickChase(DeltaTime);
+			break;
+	}
+}
+
+void UXRReplicatedPhysicsComponent::ClientTickChase(float DeltaTime)
+{
 	if (IsSequenceIDNewer(LatestSnapshot.ID, ClientActiveSnapshot.ID))
 	{
 		ClientActiveSnapshot = LatestSnapshot;
@@ -196,12 +347,139 @@ void UXRReplicatedPhysicsComponent::ClientTick(float DeltaTime)
 
 }
 
-bool UXRReplicatedPhysicsComponent::IsSequenceIDNewer(uint32 InID1, uint32 InID2) const
+bool UXRReplicatedPhysicsComponent::IsSequenceIDNewer(uint16 InID1, uint16 InID2) const
 {
-	int32 delta = InID1 - InID2;
-
 	// Check if InID1 is "ahead" of InID2, considering wrap-around.
-	return (delta > 0) || (delta < -static_cast<int32>(UINT32_MAX / 2));
+	return static_cast<int16>(InID1 - InID2) > 0;
+}
+
+// -----------------------------------------------------------------------------------------------------------------------------------
+// Dead Reckoning
+// -----------------------------------------------------------------------------------------------------------------------------------
+void UXRReplicatedPhysicsComponent::ExtrapolateSnapshot(const FXRPhysicsSnapshot& InSnapshot, double InServerTime, FVector& OutLocation, FQuat& OutRotation) const
+{
+	const double Time = FMath::Clamp(InServerTime - InSnapshot.ServerTime, 0.0, static_cast<double>(MaxExtrapolationTime));
+	OutLocation = InSnapshot.Location + InSnapshot.LinearVelocity * Time;
+	OutRotation = InSnapshot.Rotation.Quaternion();
+	// Same World gravity on server and clients, so both extrapolate the same ballistic curve
+	if (InSnapshot.bIsGravityEnabled && !InSnapshot.bIsAtRest)
+	{
+		OutLocation.Z += 0.5 * GetWorld()->GetGravityZ() * Time * Time;
+	}
+
+	const double AngularSpeed = InSnapshot.AngularVelocity.Size();
+	if (AngularSpeed > UE_KINDA_SMALL_NUMBER)
+	{
+		// World space angular velocity, applied before the Snapshot rotation
+		const FQuat DeltaRotation(InSnapshot.AngularVelocity / AngularSpeed, FMath::DegreesToRadians(AngularSpeed * Time));
+		OutRotation = (DeltaRotation * OutRotation).GetNormalized();
+	}
+}
+
+void UXRReplicatedPhysicsComponent::BeginCorrection()
+{
+	// Offset between what is shown right now and where the new Snapshot says the body is, blended out over CorrectionBlendTime
+	FVector PredictedLocation;
+	FQuat PredictedRotation;
+	ExtrapolateSnapshot(LatestSnapshot, GetServerTime(), PredictedLocation, PredictedRotation);
+	CorrectionLocationOffset = GetOwner()->GetActorLocation() - PredictedLocation;
+	CorrectionRotationOffset = GetOwner()->GetActorQuat() * PredictedRotation.Inverse();
+	// Local time, the approximated server clock can jump when it resyncs
+	CorrectionStartTime = GetWorld()->GetTimeSeconds();
+}
+
+void UXRReplicatedPhysicsComponent::ClientTickDeadReckoning(float DeltaTime)
+{
+	FVector Location;
+	FQuat Rotation;
+	ExtrapolateSnapshot(LatestSnapshot, GetServerTime(), Location, Rotation);
+
+	const double BlendAlpha = CorrectionBlendTime > 0.0f ? FMath::Clamp((GetWorld()->GetTimeSeconds() - CorrectionStartTime) / CorrectionBlendTime, 0.0, 1.0) : 1.0;
+	if (BlendAlpha < 1.0)
+	{
+		Location += CorrectionLocationOffset * (1.0 - BlendAlpha);
+		Rotation = FQuat::Slerp(CorrectionRotationOffset, FQuat::Identity, BlendAlpha) * Rotation;
+	}
+	GetOwner()->SetActorLocationAndRotation(Location, Rotation);
+}
+
+// -----------------------------------------------------------------------------------------------------------------------------------
+// Snapshot Buffer
+// -----------------------------------------------------------------------------------------------------------------------------------
+void UXRReplicatedPhysicsComponent::BufferSnapshot(const FXRPhysicsSnapshot& InSnapshot)
+{
+	// Out of order or duplicate Snapshots carry no new information
+	if (SnapshotBufferCount > 0 && InSnapshot.ServerTime <= GetBufferedSnapshot(SnapshotBufferCount - 1).ServerTime)
+	{
+		return;
+	}
+	if (SnapshotBufferCount == SnapshotBufferCapacity)
+	{
+		SnapshotBufferHead = (SnapshotBufferHead + 1) % SnapshotBufferCapacity;
+		SnapshotBufferCount--;
+	}
+	FBufferedSnapshot& Buffered = SnapshotBuffer[(SnapshotBufferHead + SnapshotBufferCount) % SnapshotBufferCapacity];
+	Buffered.ServerTime = InSnapshot.ServerTime;
+	Buffered.Location = InSnapshot.Location;
+	Buffered.Rotation = InSnapshot.Rotation.Quaternion();
+	Buffered.LinearVelocity = InSnapshot.LinearVelocity;
+	Buffered.bIsAtRest = InSnapshot.bIsAtRest != 0;
+	SnapshotBufferCount++;
+}
+
+void UXRReplicatedPhysicsComponent::DiscardBufferedSnapshots(int32 InCount)
+{
+	InCount = FMath::Clamp(InCount, 0, SnapshotBufferCount);
+	SnapshotBufferHead = (SnapshotBufferHead + InCount) % SnapshotBufferCapacity;
+	SnapshotBufferCount -= InCount;
+}
+
+const UXRReplicatedPhysicsComponent::FBufferedSnapshot& UXRReplicatedPhysicsComponent::GetBufferedSnapshot(int32 InIndex) const
+{
+	return SnapshotBuffer[(SnapshotBufferHead + InIndex) % SnapshotBufferCapacity];
+}
+
+void UXRReplicatedPhysicsComponent::ClientTickBuffered(float DeltaTime)
+{
+	if (SnapshotBufferCount == 0)
+	{
+		return;
+	}
+	const double RenderTime = GetServerTime() - RenderDelay;
+
+	// Latest Snapshot at or before the render time
+	int32 FromIndex = SnapshotBufferCount - 1;
+	while (FromIndex > 0 && GetBufferedSnapshot(FromIndex).ServerTime > RenderTime)
+	{
+		FromIndex--;
+	}
+	const FBufferedSnapshot& From = GetBufferedSnapshot(FromIndex);
+
+	// Render time outside of the buffered range, hold the closest Snapshot
+	if (FromIndex == SnapshotBufferCount - 1 || RenderTime <= From.ServerTime)
+	{
+		GetOwner()->SetActorLocationAndRotation(From.Location, From.Rotation);
+		// The render time passed the rest Snapshot, the buffer restarts from it once the body wakes up
+		if (From.bIsAtRest && RenderTime >= From.ServerTime)
+		{
+			DiscardBufferedSnapshots(FromIndex);
+		}
+		return;
+	}
+
+	const FBufferedSnapshot& To = GetBufferedSnapshot(FromIndex + 1);
+	const double Duration = FMath::Max(To.ServerTime - From.ServerTime, static_cast<double>(UE_KINDA_SMALL_NUMBER));
+	const double Alpha = FMath::Clamp((RenderTime - From.ServerTime) / Duration, 0.0, 1.0);
+
+	// Hermite tangents are the replicated velocities scaled to the segment duration. Segments starting at rest (waking up) can span any amount of time,
+	// their start tangent is zero and the scale is limited to two replication intervals, otherwise the curve overshoots far beyond the samples.
+	const double MaxTangentDuration = 2.0 * FMath::Max3(DefaultReplicationInterval, InteractedReplicationInterval, 1.0f / 30.0f);
+	const double TangentDuration = FMath::Min(Duration, MaxTangentDuration);
+	const FVector FromTangent = From.bIsAtRest ? FVector::ZeroVector : From.LinearVelocity * TangentDuration;
+	const FVector ToTangent = To.LinearVelocity * TangentDuration;
+	const FVector Location = FMath::CubicInterp(From.Location, FromTangent, To.Location, ToTangent, Alpha);
+	const FQuat Rotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha);
+	GetOwner()->SetActorLocationAndRotation(Location, Rotation);
 }
 
 // -----------------------------------------------------------------------------------------------------------------------------------
@@ -269,5 +547,168 @@ void UXRReplicatedPhysicsComponent::GetLifetimeReplicatedProps(TArray<FLifetimeP
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(UXRReplicatedPhysicsComponent, LatestSnapshot);
-	DOREPLIFETIME(UXRReplicatedPhysicsComponent, CachedSnapshot);
+}
+
+// -----------------------------------------------------------------------------------------------------------------------------------
+// Snapshot Serialization
+// -----------------------------------------------------------------------------------------------------------------------------------
+static uint32 GetQuantizedHalfSteps(float InPrecision, float InBound)
+{
+	const double Precision = FMath::Max(InPrecision, 0.001f);
+	const double Bound = FMath::Max(InBound, 1.0f);
+	// SerializeInt addresses values below 2^31
+	return static_cast<uint32>(FMath::Min(FMath::CeilToDouble(Bound / Precision), static_cast<double>(MAX_int32 / 2)));
+}
+
+// Each axis is sent as a step count from -InBound, values outside the bound are clamped
+static void SerializeQuantizedVector(FArchive& Ar, FVector& InOutVector, float InPrecision, float InBound)
+{
+	const double Precision = FMath::Max(InPrecision, 0.001f);
+	const double Bound = FMath::Max(InBound, 1.0f);
+	const uint32 HalfSteps = GetQuantizedHalfSteps(InPrecision, InBound);
+	const uint32 ValueMax = HalfSteps * 2 + 1;
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		uint32 Quantized = 0;
+		if (Ar.IsSaving())
+		{
+			const int64 Steps = FMath::RoundToInt64(FMath::Clamp(InOutVector[Axis], -Bound, Bound) / Precision);
+			Quantized = static_cast<uint32>(FMath::Clamp<int64>(Steps + HalfSteps, 0, ValueMax - 1));
+		}
+		Ar.SerializeInt(Quantized, ValueMax);
+		if (Ar.IsLoading())
+		{
+			InOutVector[Axis] = (static_cast<int64>(Quantized) - static_cast<int64>(HalfSteps)) * Precision;
+		}
+	}
+}
+
+// Smallest-three: the largest quaternion component is dropped and rebuilt from the unit length, the others lie within +-1/sqrt(2)
+static void SerializeSmallestThreeRotation(FArchive& Ar, FRotator& InOutRotation)
+{
+	constexpr double ComponentRange = 0.70710678118654752;
+	const int32 Bits = FMath::Clamp(GetDefault<UXRCoreSettings>()->SnapshotRotationBits, 6, 15);
+	const uint32 ValueMax = 1u << Bits;
+
+	double Components[4] = {};
+	uint32 LargestIndex = 0;
+	if (Ar.IsSaving())
+	{
+		const FQuat Quat = InOutRotation.Quaternion().GetNormalized();
+		Components[0] = Quat.X;
+		Components[1] = Quat.Y;
+		Components[2] = Quat.Z;
+		Components[3] = Quat.W;
+		for (uint32 Index = 1; Index < 4; Index++)
+		{
+			if (FMath::Abs(Components[Index]) > FMath::Abs(Components[LargestIndex]))
+			{
+				LargestIndex = Index;
+			}
+		}
+		// q and -q are the same rotation, sending the largest as positive saves its sign
+		if (Components[LargestIndex] < 0.0)
+		{
+			for (double& Component : Components)
+			{
+				Component = -Component;
+			}
+		}
+	}
+	Ar.SerializeInt(LargestIndex, 4);
+	LargestIndex = FMath::Min(LargestIndex, 3u);
+
+	double SumSquares = 0.0;
+	for (uint32 Index = 0; Index < 4; Index++)
+	{
+		if (Index == LargestIndex)
+		{
+			continue;
+		}
+		uint32 Quantized = 0;
+		if (Ar.IsSaving())
+		{
+			const double Normalized = FMath::Clamp(Components[Index] / ComponentRange, -1.0, 1.0) * 0.5 + 0.5;
+			Quantized = static_cast<uint32>(FMath::RoundToInt64(Normalized * (ValueMax - 1)));
+		}
+		Ar.SerializeInt(Quantized, ValueMax);
+		if (Ar.IsLoading())
+		{
+			Components[Index] = (static_cast<double>(Quantized) / (ValueMax - 1) * 2.0 - 1.0) * ComponentRange;
+			SumSquares += FMath::Square(Components[Index]);
+		}
+	}
+
+	if (Ar.IsLoading())
+	{
+		Components[LargestIndex] = FMath::Sqrt(FMath::Max(0.0, 1.0 - SumSquares));
+		InOutRotation = FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized().Rotator();
+	}
+}
+
+bool FXRPhysicsSnapshot::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Ar << ID;
+
+	uint8 Flags = 0;
+	if (Ar.IsSaving())
+	{
+		Flags = (bIsInteractedWith ? 1 : 0) | (bIsAtRest ? 2 : 0) | (bIsGravityEnabled ? 4 : 0);
+	}
+	Ar.SerializeBits(&Flags, 3);
+	if (Ar.IsLoading())
+	{
+		bIsInteractedWith = (Flags & 1) != 0;
+		bIsAtRest = (Flags & 2) != 0;
+		bIsGravityEnabled = (Flags & 4) != 0;
+	}
+
+	const UXRCoreSettings* Settings = GetDefault<UXRCoreSettings>();
+	SerializeQuantizedVector(Ar, Location, Settings->SnapshotLocationPrecision, Settings->SnapshotLocationBound);
+	SerializeSmallestThreeRotation(Ar, Rotation);
+	if (!bIsAtRest)
+	{
+		SerializeQuantizedVector(Ar, LinearVelocity, Settings->SnapshotLinearVelocityPrecision, Settings->SnapshotLinearVelocityBound);
+		SerializeQuantizedVector(Ar, AngularVelocity, Settings->SnapshotAngularVelocityPrecision, Settings->SnapshotAngularVelocityBound);
+	}
+	else if (Ar.IsLoading())
+	{
+		LinearVelocity = FVector::ZeroVector;
+		AngularVelocity = FVector::ZeroVector;
+	}
+
+	// Wraps after ~49 days, clients only compare Snapshots close to each other
+	uint32 ServerTimeMs = 0;
+	if (Ar.IsSaving())
+	{
+		ServerTimeMs = static_cast<uint32>(static_cast<uint64>(FMath::Max(ServerTime, 0.0) * 1000.0));
+	}
+	Ar << ServerTimeMs;
+	if (Ar.IsLoading())
+	{
+		ServerTime = ServerTimeMs / 1000.0;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+int32 FXRPhysicsSnapshot::GetNetSerializedBits() const
+{
+	const UXRCoreSettings* Settings = GetDefault<UXRCoreSettings>();
+	const auto VectorBits = [](float InPrecision, float InBound)
+	{
+		return 3 * static_cast<int32>(FMath::CeilLogTwo(GetQuantizedHalfSteps(InPrecision, InBound) * 2 + 1));
+	};
+	// ID, flags, largest component index, server time
+	int32 Bits = 16 + 3 + 2 + 32;
+	Bits += VectorBits(Settings->SnapshotLocationPrecision, Settings->SnapshotLocationBound);
+	Bits += 3 * FMath::Clamp(Settings->SnapshotRotationBits, 6, 15);
+	if (!bIsAtRest)
+	{
+		Bits += VectorBits(Settings->SnapshotLinearVelocityPrecision, Settings->SnapshotLinearVelocityBound);
+		Bits += VectorBits(Settings->SnapshotAngularVelocityPrecision, Settings->SnapshotAngularVelocityBound);
+	}
+	return Bits;
 }
@@ -3,6 +3,7 @@
 #include "XRInteractorComponent.h"
 #include "XRConnectorComponent.h"
 #include "XRConnectorSocket.h"
+#include "XRInteractionSubsystem.h"
 
 
 EXRStandard UXRToolsUtilityFunctions::GetXRStandard()
@@ -20,16 +21,10 @@ bool UXRToolsUtilityFunctions::IsActorInteractive(AActor* InActor, TArray<UXRInt
     }
 
     OutXRInteractions.Empty();
-    TArray<UActorComponent*> Components;
-    InActor->GetComponents(Components);
-
-    for (UActorComponent* Component : Components)
+    if (UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(InActor))
     {
-        UXRInteractionComponent* InteractionComponent = Cast<UXRInteractionComponent>(Component);
-        if (InteractionComponent)
-        {
-            OutXRInteractions.Add(InteractionComponent);
-        }
+        const TArrayView<UXRInteractionComponent* const> ActorInteractions = InteractionSubsystem->GetInteractionsForActor(InActor);
+        OutXRInteractions.Append(ActorInteractions.GetData(), ActorInteractions.Num());
     }
 
     return OutXRInteractions.Num() > 0;
@@ -45,12 +40,14 @@ bool UXRToolsUtilityFunctions::IsActorInteractedWith(AActor* InActor, TArray<UXR
     }
 
     OutActiveXRInteractions.Empty();
-    TArray<UActorComponent*> Components;
-    InActor->GetComponents(Components);
+    UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(InActor);
+    if (!InteractionSubsystem)
+    {
+        return false;
+    }
 
-    for (UActorComponent* Component : Components)
+    for (UXRInteractionComponent* InteractionComponent : InteractionSubsystem->GetInteractionsForActor(InActor))
     {
-        UXRInteractionComponent* InteractionComponent = Cast<UXRInteractionComponent>(Component);
         if (InteractionComponent && InteractionComponent->IsInteractedWith())
         {
             OutActiveXRInteractions.Add(InteractionComponent);
@@ -61,76 +58,86 @@ bool UXRToolsUtilityFunctions::IsActorInteractedWith(AActor* InActor, TArray<UXR
 }
 
 
-UXRInteractionComponent* UXRToolsUtilityFunctions::GetXRInteractionByPriority(TArray<UXRInteractionComponent*> InInteractions, UXRInteractorComponent* InXRInteractor, int32 InPriority, 
-    EXRInteractionPrioritySelection InPrioritySelectionCondition, int32 MaxSecondaryPriority)
+UXRInteractionComponent* UXRToolsUtilityFunctions::GetXRInteractionByPriority(const TArray<UXRInteractionComponent*>& InInteractions, UXRInteractorComponent* InXRInteractor, int32 InPriority, 
+    EXRInteractionPrioritySelection InPrioritySelectionCondition)
 {
-    if (InInteractions.Num() == 0)
-    {
-        return nullptr;
-    }
-    TArray<UXRInteractionComponent*> ValidXRInteractions = {};
+    return GetXRInteractionByPriority(MakeArrayView(InInteractions), InXRInteractor, InPriority, InPrioritySelectionCondition);
+}
+
+
+UXRInteractionComponent* UXRToolsUtilityFunctions::GetXRInteractionByPriority(TArrayView<UXRInteractionComponent* const> InInteractions, UXRInteractorComponent* InXRInteractor, int32 InPriority, 
+    EXRInteractionPrioritySelection InPrioritySelectionCondition)
+{
+    UXRInteractionComponent* BestXRInteraction = nullptr;
+    int32 BestPriority = 0;
     for (UXRInteractionComponent* XRInteraction : InInteractions)
     {
-        if (!XRInteraction)
-        {
-            continue;
-        }
-        // Discard Disabled Components
-        if (!XRInteraction->IsActive())
+        if (!IsXRInteractionSelectable(XRInteraction, InXRInteractor))
         {
             continue;
         }
-        // Discard Interactions unavailable to Lasers (if LaserInteractor)
-        if (InXRInteractor)
+
+        const int32 Priority = XRInteraction->GetInteractionPriority();
+        if (Priority == InPriority)
         {
-            if (InXRInteractor->IsLaserInteractor() && XRInteraction->GetLaserBehavior() == EXRLaserBehavior::Disabled)
-            {
-                continue;
-            }
+            return XRInteraction;
         }
-        if (XRInteraction->IsInteractedWith())
+
+        // Keep the closest Priority in the allowed direction, the first found Interaction wins ties
+        bool bIsBetter = false;
+        switch (InPrioritySelectionCondition)
         {
-            if (InXRInteractor)
-            {
-                // This Interactor is already Interacting with this Interaction
-                if (XRInteraction->GetActiveInteractors().Contains(InXRInteractor))
-                {
-                    continue;
-                }
-            }
-            // Adhere to MultiInteractor behavior
-            switch (XRInteraction->GetMultiInteractorBehavior())
-            {
-                default:
-                    break;
-                case EXRMultiInteractorBehavior::Disabled:
-                    continue;
-            }
+            case EXRInteractionPrioritySelection::Equal:
+                break;
+            case EXRInteractionPrioritySelection::HigherEqual:
+                bIsBetter = Priority < InPriority && (!BestXRInteraction || Priority > BestPriority);
+                break;
+            case EXRInteractionPrioritySelection::LowerEqual:
+                bIsBetter = Priority > InPriority && (!BestXRInteraction || Priority < BestPriority);
+                break;
         }
-        if (XRInteraction->GetInteractionPriority() == InPriority)
+        if (bIsBetter)
         {
-            return XRInteraction;
+            BestXRInteraction = XRInteraction;
+            BestPriority = Priority;
         }
-        ValidXRInteractions.Add(XRInteraction);
     }
+    return BestXRInteraction;
+}
 
-    int32 NextPriority = InPriority;
-    switch (InPrioritySelectionCondition)
+bool UXRToolsUtilityFunctions::IsXRInteractionSelectable(const UXRInteractionComponent* InInteraction, const UXRInteractorComponent* InXRInteractor)
+{
+    if (!InInteraction)
     {
-        case EXRInteractionPrioritySelection::Equal:
-            return nullptr;
-        case EXRInteractionPrioritySelection::HigherEqual:
-            NextPriority = InPriority - 1;
-            break;
-        case EXRInteractionPrioritySelection::LowerEqual:
-            NextPriority = InPriority + 1;
-            break;
+        return false;
     }
-    if (NextPriority < 0 || NextPriority >= MaxSecondaryPriority)
+    // Discard Disabled Components
+    if (!InInteraction->IsActive())
     {
-        return nullptr;
+        return false;
     }
-    return GetXRInteractionByPriority(ValidXRInteractions, InXRInteractor, NextPriority, InPrioritySelectionCondition);
+    // Discard Interactions unavailable to Lasers (if LaserInteractor)
+    if (InXRInteractor)
+    {
+        if (InXRInteractor->IsLaserInteractor() && InInteraction->GetLaserBehavior() == EXRLaserBehavior::Disabled)
+        {
+            return false;
+        }
+    }
+    if (InInteraction->IsInteractedWith())
+    {
+        // This Interactor is already Interacting with this Interaction
+        if (InXRInteractor && InInteraction->HasActiveInteractor(InXRInteractor))
+        {
+            return false;
+        }
+        // Adhere to MultiInteractor behavior
+        if (InInteraction->GetMultiInteractorBehavior() == EXRMultiInteractorBehavior::Disabled)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 
@@ -141,19 +148,12 @@ UXRInteractionComponent* UXRToolsUtilityFunctions::GetXRInteractionOnActorByPrio
         return nullptr;
     }
 
-    TArray<UActorComponent*> Components;
-    InActor->GetComponents(Components);
-    TArray<UXRInteractionComponent*> InteractionComponents;
-
-    for (UActorComponent* Component : Components)
+    UXRInteractionSubsystem* InteractionSubsystem = UXRInteractionSubsystem::Get(InActor);
+    if (!InteractionSubsystem)
     {
-        UXRInteractionComponent* InteractionComponent = Cast<UXRInteractionComponent>(Component);
-        if (InteractionComponent)
-        {
-            InteractionComponents.Add(InteractionComponent);
-        }
+        return nullptr;
     }
-    return GetXRInteractionByPriority(InteractionComponents, InXRInteractor, InPriority, InPrioritySelectionCondition);
+    return GetXRInteractionByPriority(InteractionSubsystem->GetInteractionsForActor(InActor), InXRInteractor, InPriority, InPrioritySelectionCondition);
 }
 
 bool UXRToolsUtilityFunctions::TryConnectToActor(UXRConnectorComponent* InConnector, AActor* InActor, const FString& InSocketID)
@@ -183,4 +183,9 @@ bool UXRToolsUtilityFunctions::TryConnectToActor(UXRConnectorComponent* InConnec
     }
 
     return false;
-}
\ No newline at end of file
+}
+
+bool UXRToolsUtilityFunctions::IsProjectCollisionChannel(ECollisionChannel InChannel)
+{
+    return InChannel >= ECC_GameTraceChannel1 && InChannel <= ECC_GameTraceChannel18;
+}
@@ -3,9 +3,13 @@
 #include "XR_Toolkit.h"
 #include "XRCoreSettings.h"
 #include "ISettingsModule.h"
+#include "Engine/Engine.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FXR_ToolkitModule"
 
+DEFINE_LOG_CATEGORY(LogXRToolkit);
+
 void FXR_ToolkitModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -20,12 +24,88 @@ void FXR_ToolkitModule::StartupModule()
     }
 
     // GEngine->SetNetDriverClass(UXRCoreNetDriver::StaticClass());
+
+	// Asset loading is only available once the engine is up, the module may also be loaded after that
+	if (GEngine && GEngine->IsInitialized())
+	{
+		PreloadDefaultAssets();
+	}
+	else
+	{
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FXR_ToolkitModule::PreloadDefaultAssets);
+	}
 }
 
 void FXR_ToolkitModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	DefaultAssetsHandle.Reset();
+	DefaultAssetsLoadedDelegate.Clear();
+}
+
+FXR_ToolkitModule& FXR_ToolkitModule::Get()
+{
+	return FModuleManager::LoadModuleChecked<FXR_ToolkitModule>("XR_Toolkit");
+}
+
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Default Assets
+// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+void FXR_ToolkitModule::PreloadDefaultAssets()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	if (DefaultAssetsHandle.IsValid() || bDefaultAssetsLoaded)
+	{
+		return;
+	}
+
+	const UXRCoreSettings* Settings = GetDefault<UXRCoreSettings>();
+	TArray<FSoftObjectPath> DefaultAssets = {};
+	for (const FSoftObjectPath& AssetPath : {Settings->DefaultInteractionStartSound.ToSoftObjectPath(), Settings->DefaultInteractionEndSound.ToSoftObjectPath(),
+		Settings->DefaultHighlightFadeCurve.ToSoftObjectPath(), Settings->DefaultHologramClass.ToSoftObjectPath()})
+	{
+		if (AssetPath.IsValid())
+		{
+			DefaultAssets.AddUnique(AssetPath);
+		}
+	}
+	// The handle keeps the assets loaded for the lifetime of the module
+	DefaultAssetsHandle = StreamableManager.RequestAsyncLoad(DefaultAssets, FStreamableDelegate::CreateRaw(this, &FXR_ToolkitModule::OnDefaultAssetsLoaded),
+		FStreamableManager::AsyncLoadHighPriority, true);
+	if (!DefaultAssetsHandle.IsValid())
+	{
+		// Nothing to load
+		OnDefaultAssetsLoaded();
+	}
+}
+
+void FXR_ToolkitModule::OnDefaultAssetsLoaded()
+{
+	bDefaultAssetsLoaded = true;
+	DefaultAssetsLoadedDelegate.Broadcast();
+	DefaultAssetsLoadedDelegate.Clear();
+}
+
+TSharedPtr<FStreamableHandle> FXR_ToolkitModule::GetDefaultAssetsHandle() const
+{
+	return DefaultAssetsHandle;
+}
+
+bool FXR_ToolkitModule::AreDefaultAssetsLoaded() const
+{
+	return bDefaultAssetsLoaded;
+}
+
+void FXR_ToolkitModule::CallWhenDefaultAssetsLoaded(FSimpleDelegate InDelegate)
+{
+	if (AreDefaultAssetsLoaded())
+	{
+		InDelegate.ExecuteIfBound();
+		return;
+	}
+	DefaultAssetsLoadedDelegate.Add(InDelegate);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XRAudioPoolSubsystem.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+
+/**
+ * Handle to a sound played through the XRAudioPoolSubsystem. Becomes stale once its voice is reused for another sound.
+ */
+USTRUCT()
+struct FXRAudioHandle
+{
+	GENERATED_BODY()
+
+	int32 VoiceIndex = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return VoiceIndex != INDEX_NONE; }
+	void Reset() { VoiceIndex = INDEX_NONE; Serial = 0; }
+};
+
+USTRUCT()
+struct FXRPooledAudioVoice
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UAudioComponent* AudioComponent = nullptr;
+
+	UPROPERTY()
+	USoundBase* Sound = nullptr;
+
+	// Incremented whenever the voice is (re)started, invalidates handles to the previous sound
+	uint32 Serial = 0;
+	double StartTime = 0.0;
+};
+
+/**
+ * World-level pool of reusable AudioComponents for one-shot Interaction sounds.
+ * Limits the concurrent voices per sound and in total (see XRCoreSettings), stealing the oldest voice when a limit is reached.
+ * Not created on dedicated servers.
+ */
+UCLASS()
+class XR_TOOLKIT_API UXRAudioPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Play the sound at the given location on a pooled voice. Returns an invalid handle if the sound could not be played.
+	 */
+	FXRAudioHandle PlaySoundAtLocation(USoundBase* InSound, const FVector& InLocation);
+
+	/**
+	 * Stop the sound if the handle still owns its voice. Resets the handle.
+	 */
+	void StopSound(FXRAudioHandle& InOutHandle);
+
+	/**
+	 * Convenience accessor, returns nullptr if the World has no XRAudioPoolSubsystem (iE. on dedicated servers).
+	 */
+	static UXRAudioPoolSubsystem* Get(const UObject* InWorldContextObject);
+
+private:
+	int32 AcquireVoice(const USoundBase* InSound);
+	int32 CreateVoice();
+	bool IsVoicePlaying(const FXRPooledAudioVoice& InVoice) const;
+
+	UPROPERTY()
+	TArray<FXRPooledAudioVoice> Voices;
+};
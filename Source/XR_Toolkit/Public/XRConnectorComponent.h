@@ -18,6 +18,8 @@ class UXRInteractorComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnConnected, UXRConnectorComponent*, Sender, UXRConnectorSocket*, XRConnectorSocket);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDisconnected, UXRConnectorComponent*, Sender, UXRConnectorSocket*, XRConnectorSocket);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnConnectedNative, UXRConnectorComponent*, UXRConnectorSocket*);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnDisconnectedNative, UXRConnectorComponent*, UXRConnectorSocket*);
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class XR_TOOLKIT_API UXRConnectorComponent : public UActorComponent
@@ -29,8 +31,10 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category = "XRConnector")
 	FOnConnected OnConnected;
+	FOnConnectedNative OnConnectedNative;
 	UPROPERTY(BlueprintAssignable, Category = "XRConnector")
 	FOnDisconnected OnDisconnected;
+	FOnDisconnectedNative OnDisconnectedNative;
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// API
@@ -161,6 +165,7 @@ protected:
 	/*
 	* Set the type of hologram that should be spawned.
 	* This must implement the Interface IXRHologramInterface. See XRConnectorHologram as an example.
+	* If not set, the DefaultHologramClass of the XRCoreSettings is used.
 	*/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "XRConnector|Hologram")
 	TSubclassOf<AActor> HologramClass;
@@ -189,6 +194,8 @@ private:
 	void InitializeOverlapBindings();
 	TArray<UPrimitiveComponent*> OwnerCollisions = {};
 	TArray<TWeakObjectPtr<UXRConnectorSocket>> OverlappedSockets = {};
+	// Number of OwnerCollisions overlapping each Socket, only updated from Begin/EndOverlap events
+	TMap<TWeakObjectPtr<UXRConnectorSocket>, int32> SocketOverlapCounts = {};
 	TWeakObjectPtr<UXRConnectorSocket> ClosestSocket = {};
 	UFUNCTION()
 	void OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -199,15 +206,16 @@ private:
 	// Hologram
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	TMap<TWeakObjectPtr<UXRConnectorSocket>, TWeakObjectPtr<AActor>> AssignedHolograms = {};
+	// HologramClass, the preloaded XRCoreSettings default or XRConnectorHologram, in that order
+	TSubclassOf<AActor> GetHologramClass() const;
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// Interaction Mappings
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	void InitializeInteractionBindings();
 	UXRInteractionGrab* BoundGrabComponent = nullptr;
-	UFUNCTION()
+	// Bound to the native delegates of the BoundGrabComponent
 	void OnInteractionStarted(UXRInteractionComponent* Sender, UXRInteractorComponent* XRInteractorComponent);
-	UFUNCTION()
 	void OnInteractionEnded(UXRInteractionComponent* Sender, UXRInteractorComponent* XRInteractorComponent);
 
 };
@@ -19,6 +19,8 @@ enum class EXRConnectorSocketState : uint8
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSocketConnected, UXRConnectorSocket*, Sender, UXRConnectorComponent*, XRConnector);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSocketDisconnected, UXRConnectorSocket*, Sender, UXRConnectorComponent*, XRConnector);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSocketConnectedNative, UXRConnectorSocket*, UXRConnectorComponent*);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSocketDisconnectedNative, UXRConnectorSocket*, UXRConnectorComponent*);
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class XR_TOOLKIT_API UXRConnectorSocket : public USphereComponent
@@ -30,8 +32,10 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category = "XRConnectorSocket")
 	FOnSocketConnected OnSocketConnected;
+	FOnSocketConnectedNative OnSocketConnectedNative;
 	UPROPERTY(BlueprintAssignable, Category = "XRConnectorSocket")
 	FOnSocketDisconnected OnSocketDisconnected;
+	FOnSocketDisconnectedNative OnSocketDisconnectedNative;
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// API
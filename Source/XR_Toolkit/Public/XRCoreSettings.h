@@ -61,6 +61,18 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Defaults", meta = (AllowedClasses = "Actor"))
 	TSoftClassPtr<AActor> DefaultHologramClass;
 
+	/**
+	 * Maximum number of pooled AudioComponents per World used for Interaction sounds. The oldest voice is stolen once all are playing.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Audio", meta = (ClampMin = "1"))
+	int32 AudioPoolSize = 16;
+
+	/**
+	 * Maximum number of voices playing the same sound at once. Further requests restart the oldest voice of that sound.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Audio", meta = (ClampMin = "1"))
+	int32 MaxVoicesPerSound = 4;
+
 	/**
 	 * The replication interval, in seconds, for sending snapshots from the server to all clients. 
 	**/
@@ -72,4 +84,83 @@ public:
 	 **/
 	UPROPERTY(EditDefaultsOnly, Category = "Physics Replication")
 	float InteractedReplicationInterval = 0.01f;
+
+	/**
+	 * Precision, in cm, of replicated physics Snapshot locations. Lower values cost more bits per axis.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication", meta = (ClampMin = "0.001"))
+	float SnapshotLocationPrecision = 0.05f;
+
+	/**
+	 * Replicated physics Snapshot locations are clamped to +- this distance, in cm, from the world origin on each axis.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication", meta = (ClampMin = "1.0"))
+	float SnapshotLocationBound = 100000.0f;
+
+	/**
+	 * Bits per component of the smallest-three compressed Snapshot rotation. 11 bits keep the error below ~0.1 degrees.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication", meta = (ClampMin = "6", ClampMax = "15"))
+	int32 SnapshotRotationBits = 11;
+
+	/**
+	 * Precision, in cm/s, of replicated physics Snapshot linear velocities.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication", meta = (ClampMin = "0.001"))
+	float SnapshotLinearVelocityPrecision = 0.1f;
+
+	/**
+	 * Replicated physics Snapshot linear velocities are clamped to +- this speed, in cm/s, on each axis.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication", meta = (ClampMin = "1.0"))
+	float SnapshotLinearVelocityBound = 10000.0f;
+
+	/**
+	 * Precision, in deg/s, of replicated physics Snapshot angular velocities.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication", meta = (ClampMin = "0.001"))
+	float SnapshotAngularVelocityPrecision = 0.1f;
+
+	/**
+	 * Replicated physics Snapshot angular velocities are clamped to +- this rate, in deg/s, on each axis.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication", meta = (ClampMin = "1.0"))
+	float SnapshotAngularVelocityBound = 7200.0f;
+
+	/**
+	 * Schedule the physics bodies using an XRPhysicsReplicationManager per connection instead of fixed replication intervals.
+	 * Each connection sends the bodies with the highest accumulated priority that fit PhysicsBytesPerUpdate.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication|Scheduler")
+	bool bSchedulePhysicsPerConnection = false;
+
+	/**
+	 * Net updates per second of each connections manager. Bodies are captured at this rate, each net update sends at most PhysicsBytesPerUpdate.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication|Scheduler", meta = (ClampMin = "1.0", EditCondition = "bSchedulePhysicsPerConnection"))
+	float PhysicsSchedulerRate = 30.0f;
+
+	/**
+	 * Approximate bytes of physics Snapshots sent to each connection per net update of its manager, including the body reference exported with a bodies first send.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication|Scheduler", meta = (ClampMin = "64", EditCondition = "bSchedulePhysicsPerConnection"))
+	int32 PhysicsBytesPerUpdate = 1200;
+
+	/**
+	 * Distance, in cm, from the players head or closest hand at which a bodies priority halves.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication|Scheduler", meta = (ClampMin = "1.0", EditCondition = "bSchedulePhysicsPerConnection"))
+	float PhysicsPriorityDistanceFalloff = 500.0f;
+
+	/**
+	 * Priority added per cm (or degree) the body drifted from what the connection was last sent.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication|Scheduler", meta = (ClampMin = "0.0", EditCondition = "bSchedulePhysicsPerConnection"))
+	float PhysicsPriorityErrorScale = 0.2f;
+
+	/**
+	 * Priority multiplier for bodies that are currently interacted with.
+	**/
+	UPROPERTY(config, EditAnywhere, Category = "Physics Replication|Scheduler", meta = (ClampMin = "1.0", EditCondition = "bSchedulePhysicsPerConnection"))
+	float PhysicsPriorityInteractedScale = 4.0f;
 };
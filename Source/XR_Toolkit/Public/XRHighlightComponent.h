@@ -2,11 +2,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Components/TimelineComponent.h"
 #include "Components/ActorComponent.h"
 #include "Components/MeshComponent.h"
 #include "XRHighlightComponent.generated.h"
 
+class UCurveFloat;
+
+UENUM(BlueprintType)
+enum class EXRHighlightBackend : uint8
+{
+	MaterialParameter UMETA(DisplayName = "Material Parameter", ToolTip = "Sets the XRHighlight_State scalar parameter, creating a dynamic material instance per slot."),
+	CustomPrimitiveData UMETA(DisplayName = "Custom Primitive Data", ToolTip = "Writes the state into a custom primitive data slot, keeping shared material instances and instancing intact."),
+};
 
 
 UCLASS(Blueprintable, ClassGroup=(XRToolkit), meta=(BlueprintSpawnableComponent) )
@@ -18,7 +25,7 @@ public:
 	UXRHighlightComponent();
 
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -37,7 +44,7 @@ public:
 	float GetHighlightState();
 
 	/**
-	 * Using SetHighlightState() to Fade In or Out the Highlight via a Timeline controlled by the HighlightFadeCurve.
+	 * Using SetHighlightState() to Fade In or Out the Highlight, driven by the XRHighlightSubsystem along the HighlightFadeCurve.
 	 * HighlightState will be applied instantly if no HighlightFadeCurve is provided.
 	 * @param bFadeIn Switch between FadeIn / FadeOut.
 	 */
@@ -74,13 +81,43 @@ public:
 	UFUNCTION(BlueprintPure, Category="XRCore|Highlight")
 	TArray<UMeshComponent*> GetHighlightMeshes() const;
 
+	/**
+	 * Add a MeshComponent of the owning Actor to the highlight cache if it matches the HighlightIncludeOnlyTags.
+	 * NOTE: Meshes added to the owning Actor are picked up automatically, call manually to bring a new mesh up to date right away.
+	 */
+	UFUNCTION(BlueprintCallable, Category="XRCore|Highlight")
+	void NotifyMeshComponentAdded(UMeshComponent* InMeshComponent);
+
+	/**
+	 * Remove a MeshComponent from the highlight cache.
+	 * NOTE: Destroyed meshes are dropped automatically, unregistered ones are skipped until they are registered again.
+	 */
+	UFUNCTION(BlueprintCallable, Category="XRCore|Highlight")
+	void NotifyMeshComponentRemoved(UMeshComponent* InMeshComponent);
+
 	/**
 	 * Required to drive the Fade behavior. If none is set, HighlightState will be set instantly, even if FadeXRHighlight() is called.
 	 */
 	UPROPERTY(EditAnywhere, Category="XRCore|Highlight")
 	UCurveFloat* HighlightFadeCurve = nullptr;
+
+	/**
+	 * How the HighlightState reaches the materials. CustomPrimitiveData requires the material to read the state from custom primitive data
+	 * at HighlightCustomPrimitiveDataIndex instead of the XRHighlight_State parameter.
+	 */
+	UPROPERTY(EditAnywhere, Category="XRCore|Highlight")
+	EXRHighlightBackend HighlightBackend = EXRHighlightBackend::MaterialParameter;
+
+	UPROPERTY(EditAnywhere, Category="XRCore|Highlight", meta=(EditCondition="HighlightBackend==EXRHighlightBackend::CustomPrimitiveData", ClampMin="0"))
+	int32 HighlightCustomPrimitiveDataIndex = 0;
+
 	/**
-	 * Set the Curve to be used for Highlight fading. Will initialize a timeline and configre the fading functionality.
+	 * Set how the HighlightState is written to the cached meshes. Resets the state written through the previous backend.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "XRCore|Highlight")
+	void SetHighlightBackend(EXRHighlightBackend InHighlightBackend, int32 InCustomPrimitiveDataIndex = 0);
+	/**
+	 * Set the Curve to be used for Highlight fading.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "XRCore|Highlight")
 	void SetHighlightFadeCurve(UCurveFloat* InHighlightFadeCurve);
@@ -89,26 +126,37 @@ protected:
 	UPROPERTY()
 	FName HighlightMaterialParameter = "XRHighlight_State";
 
-	UPROPERTY()
-	FTimeline FadeTimeline;
-
-	UFUNCTION()
-	void TimelineUpdate(float InTimelineProgress);
-	UFUNCTION()
-	void TimelineFinished();
-
 	UPROPERTY()
 	float HighlightState = 0.0f;
 	
 	virtual void SetActive(bool bNewActive, bool bReset) override;
-	UFUNCTION()
-	void InitializeFadeTimeline();
 
-	
+	// Write the state to all cached meshes without affecting a running fade
+	void WriteHighlightState(float InHighlightState);
+
 private:
+	friend class UXRHighlightSubsystem;
+
+	// All MeshComponents of the owning Actor, gathered once and kept up to date incrementally
+	UPROPERTY()
+	TArray<UMeshComponent*> OwnerMeshComponents;
+	bool bOwnerMeshComponentsGathered = false;
+	// Component set of the owning Actor when OwnerMeshComponents were gathered, see GetComponentSetGeneration
+	uint32 OwnerComponentSetGeneration = 0;
+	static uint32 GetComponentSetGeneration(const AActor* InActor);
+
+	// Subset of OwnerMeshComponents matching the IncludeOnlyTagSet, without duplicates
 	UPROPERTY()
 	TArray<UMeshComponent*> HighlightableMeshComponents;
 	UFUNCTION()
 	void CacheHighlightableMeshComponents();
-	bool bIsTimelineInitialized = false;
+
+	TSet<FName> IncludeOnlyTagSet;
+	bool MatchesIncludeOnlyTags(const UMeshComponent* InMeshComponent) const;
+	// Gather the Owners meshes again if its components changed since the last gather, returns true if they did
+	bool RefreshOwnerMeshComponents();
+
+	// Position on the HighlightFadeCurve, owned by the XRHighlightSubsystem while a fade is running
+	float FadePosition = 0.0f;
+	int32 ActiveFadeIndex = INDEX_NONE;
 };
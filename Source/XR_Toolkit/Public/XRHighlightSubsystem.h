@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "XRHighlightSubsystem.generated.h"
+
+class UCurveFloat;
+class UXRHighlightComponent;
+
+/**
+ * Drives the highlight fades of all XRHighlightComponents in one tick.
+ * Fade curves are baked into lookup tables once, material parameters are only written when the quantized fade value changes.
+ * Also keeps the mesh caches of currently lit XRHighlightComponents in sync with their owners components, so meshes added at runtime light up right away.
+ */
+UCLASS()
+class XR_TOOLKIT_API UXRHighlightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Fade the Highlight forward (towards the end of the curve) or backward (towards its start), continuing from its current fade position.
+	 */
+	void PlayFade(UXRHighlightComponent* InHighlight, UCurveFloat* InFadeCurve, bool bInForward);
+
+	/**
+	 * Stop the Highlights fade, keeping its current fade position.
+	 */
+	void StopFade(UXRHighlightComponent* InHighlight);
+
+	/**
+	 * Track whether the Highlight currently shows a non-zero state.
+	 * NOTE: Called by XRHighlightComponent whenever its state is written and on EndPlay.
+	 */
+	void SetHighlightLit(UXRHighlightComponent* InHighlight, bool bInLit);
+
+	/**
+	 * Convenience accessor, returns nullptr if the World has no XRHighlightSubsystem (iE. during teardown).
+	 */
+	static UXRHighlightSubsystem* Get(const UObject* InWorldContextObject);
+
+private:
+	static constexpr int32 CurveLUTSamples = 64;
+	// Material parameters are only written if the value changed by at least one step
+	static constexpr float FadeQuantizationSteps = 1024.0f;
+
+	struct FCurveLUT
+	{
+		float MinTime = 0.0f;
+		float MaxTime = 0.0f;
+		float Samples[CurveLUTSamples] = {};
+
+		float Sample(float InTime) const;
+	};
+
+	struct FActiveFade
+	{
+		TWeakObjectPtr<UXRHighlightComponent> Highlight;
+		int32 CurveIndex = INDEX_NONE;
+		float Position = 0.0f;
+		float Direction = 1.0f;
+		int32 LastQuantizedValue = INDEX_NONE;
+	};
+
+	int32 FindOrBakeCurve(UCurveFloat* InFadeCurve);
+	void RemoveFadeAt(int32 InFadeIndex);
+
+	void RefreshLitHighlights();
+
+	TArray<TWeakObjectPtr<UXRHighlightComponent>> LitHighlights;
+
+	TArray<FActiveFade> ActiveFades;
+	TArray<FCurveLUT> CurveLUTs;
+	TMap<TObjectKey<UCurveFloat>, int32> CurveLUTIndices;
+};
@@ -4,12 +4,20 @@
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
 #include "Sound/SoundBase.h"
+#include "XRAudioPoolSubsystem.h"
+#include "XRHighlightComponent.h"
+#include "XRInteractionHandle.h"
 #include "XRInteractionComponent.generated.h"
 
 
 class UXRInteractorComponent;
 class UXRInteractionComponent;
 class UXRInteractionHighlightComponent;
+class UXRHighlightComponent;
+class UXRInteractionProfile;
+class UCurveFloat;
+class UShapeComponent;
+enum class EXRInteractionProfileOverride : uint8;
 
 UENUM(BlueprintType)
 enum class EXRInteractionPriority : uint8
@@ -35,9 +43,36 @@ enum class EXRMultiInteractorBehavior : uint8
 	TakeOver UMETA(DisplayName = "Take over from current Interactor"),
 };
 
+UENUM(BlueprintType)
+enum class EXRInteractionProxyShape : uint8
+{
+	None UMETA(DisplayName = "None", ToolTip = "XRInteractors overlap the Actors own collision."),
+	Sphere UMETA(DisplayName = "Sphere"),
+	Capsule UMETA(DisplayName = "Capsule"),
+	Box UMETA(DisplayName = "Box"),
+};
+
+UENUM(BlueprintType)
+enum class EXRHighlightCreation : uint8
+{
+	OnBeginPlay UMETA(DisplayName = "On BeginPlay"),
+	OnFirstHover UMETA(DisplayName = "On first Hover", ToolTip = "Spawn the XRHighlight the first time the Interaction is hovered."),
+};
+
+UENUM(BlueprintType)
+enum class EXRInteractionSpatialMode : uint8
+{
+	Attached UMETA(DisplayName = "Attached", ToolTip = "Stays in the transform hierarchy like any SceneComponent."),
+	Detached UMETA(DisplayName = "Detached", ToolTip = "Leaves the transform hierarchy at BeginPlay, its location is derived from the anchor on demand."),
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInteractionStarted, UXRInteractionComponent*, Sender, UXRInteractorComponent*, XRInteractorComponent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInteractionEnded, UXRInteractionComponent*, Sender, UXRInteractorComponent*, XRInteractorComponent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnInteractionHovered, UXRInteractionComponent*, Sender, UXRInteractorComponent*, HoveringXRInteractor, bool, bHovered);
+// Native counterparts of the delegates above for C++ listeners, bound without reflection. Every *Native delegate in XRCore is broadcast right before its dynamic delegate.
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInteractionStartedNative, UXRInteractionComponent*, UXRInteractorComponent*);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInteractionEndedNative, UXRInteractionComponent*, UXRInteractorComponent*);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnInteractionHoveredNative, UXRInteractionComponent*, UXRInteractorComponent*, bool);
 
 UCLASS(Blueprintable, ClassGroup=(XRToolkit), meta=(BlueprintSpawnableComponent) )
 class XR_TOOLKIT_API UXRInteractionComponent : public USceneComponent
@@ -61,6 +96,7 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category="XRCore|Interaction|Delegates")
 	FOnInteractionStarted OnInteractionStarted;
+	FOnInteractionStartedNative OnInteractionStartedNative;
 
 	
 	/**
@@ -73,6 +109,14 @@ public:
 	
 	UPROPERTY(BlueprintAssignable, Category="XRCore|Interaction|Delegates")
 	FOnInteractionEnded OnInteractionEnded;
+	FOnInteractionEndedNative OnInteractionEndedNative;
+
+	/**
+	 * Undo a locally predicted StartInteraction the server rejected. Unlike EndInteraction no end sound is played.
+	 * NOTE: Not intended to be called manually - invoked by XRInteractor.
+	 * @param InInteractor The Interactor whose predicted start was rejected.
+	 */
+	virtual void RollbackInteraction(UXRInteractorComponent* InInteractor);
 
 
 	/**
@@ -86,6 +130,7 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category = "XRCore|Interaction|Delegates")
 	FOnInteractionHovered OnInteractionHovered;
+	FOnInteractionHoveredNative OnInteractionHoveredNative;
 
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -103,12 +148,30 @@ public:
 	UFUNCTION(BlueprintPure, Category = "XRCore|Interaction")
 	bool IsHovered(TArray<UXRInteractorComponent*>& OutHoveringInteractors);
 
+	/**
+	 * Return the number of XRInteractors currently hovering this Interaction.
+	 */
+	UFUNCTION(BlueprintPure, Category = "XRCore|Interaction")
+	int32 GetHoveringInteractorCount() const;
+
 	/**
 	 * Return associated XRInteractorComponent. Can be nullptr. 
 	 */
 	UFUNCTION(BlueprintPure, Category="XRCore|Interaction")
 	TArray<UXRInteractorComponent*> GetActiveInteractors() const;
 
+	/**
+	 * Return the number of XRInteractors currently interacting with this Interaction.
+	 */
+	UFUNCTION(BlueprintPure, Category="XRCore|Interaction")
+	int32 GetActiveInteractorCount() const;
+
+	/**
+	 * Returns true if the given XRInteractor is currently interacting with this Interaction.
+	 */
+	UFUNCTION(BlueprintPure, Category="XRCore|Interaction")
+	bool HasActiveInteractor(const UXRInteractorComponent* InInteractor) const;
+
 	/**
 	* Return what happens when this interaction is active and a second XRInteractor starts interacting.
 	* Allow: Allow multiple Interactors
@@ -126,6 +189,7 @@ public:
 
 	/**
 	 * Return the assigned XRInteractionHighlightComponent. Only valid if bEnableHighlighting is true on BeginPlay.
+	 * With HighlightCreation OnFirstHover, nullptr until the first hover and after the idle release.
 	 */
 	UFUNCTION(BlueprintPure, Category = "XRCore|Interaction|Highlight")
 	UXRHighlightComponent* GetXRHighlightComponent();
@@ -149,10 +213,55 @@ public:
 	UFUNCTION(Blueprintpure, Category="XRCore|Interaction|Laser")
 	bool IsLaserInteractionEnabled() const;
 
+	/**
+	 * Return the proxy volume XRInteractors overlap instead of the Actors collision. nullptr if ProxyShape is None.
+	 */
+	UFUNCTION(BlueprintPure, Category="XRCore|Interaction|Proxy")
+	UPrimitiveComponent* GetInteractionProxy() const;
+
+	/**
+	 * Return the Component this Interaction belongs to: the attach parent, or the parent it had before detaching (see SpatialMode).
+	 */
+	UFUNCTION(BlueprintPure, Category="XRCore|Interaction|Spatial")
+	USceneComponent* GetInteractionAnchor() const;
+
+	/**
+	 * Return the world location of this Interaction. Use this instead of GetComponentLocation, which is not updated while Detached.
+	 */
+	UFUNCTION(BlueprintPure, Category="XRCore|Interaction|Spatial")
+	FVector GetInteractionLocation() const;
+
+	/**
+	 * Handle issued by the XRInteractionSubsystem during play. Invalid before BeginPlay.
+	 */
+	FXRInteractionHandle GetInteractionHandle() const;
+
+	/**
+	 * Drop the XRInteractor from the hover and interaction state without any events.
+	 * NOTE: Called by XRInteractor on EndPlay.
+	 */
+	void RemoveInteractor(const FXRInteractorHandle& InInteractorHandle);
+
+	/**
+	 * Return the shared XRInteractionProfile. Can be nullptr.
+	 */
+	UFUNCTION(BlueprintPure, Category="XRCore|Interaction|Profile")
+	UXRInteractionProfile* GetInteractionProfile() const;
+
+	/**
+	 * Switch to another XRInteractionProfile. Settings this Interaction overrides keep their own value.
+	 */
+	UFUNCTION(BlueprintCallable, Category="XRCore|Interaction|Profile")
+	void SetInteractionProfile(UXRInteractionProfile* InInteractionProfile);
+
 
 protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void OnAttachmentChanged() override;
 	virtual void InitializeComponent() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// Abstract Interaction Events 
@@ -178,6 +287,22 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category="XRCore|Interaction")
 	void OnInteractionHover(bool bHovering, UXRInteractorComponent* HoveringXRInteractor);
 
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Config - Profile
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	/**
+	 * Shared configuration for this category of Interactions. If set, the profile provides Priority, Multi Interactor and Laser behavior,
+	 * Highlight tags and curve as well as the Interaction sounds, except for the settings selected in ProfileOverrides.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Profile")
+	UXRInteractionProfile* InteractionProfile = nullptr;
+
+	/**
+	 * Settings that use the value of this Interaction instead of the InteractionProfile.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Profile", meta = (Bitmask, BitmaskEnum = "/Script/XR_Toolkit.EXRInteractionProfileOverride", EditCondition = "InteractionProfile"))
+	int32 ProfileOverrides = 0;
+
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// Config - General
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -217,6 +342,61 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|General")
 	EXRLaserBehavior LaserBehavior = EXRLaserBehavior::Snap;
 
+	/**
+	 * Make the owning Actor replicate. The Interaction state itself replicates through the XRInteractors, disable this for props whose physics replicate
+	 * through an XRPhysicsReplicationManager so they need no Actor channel of their own.
+	 * NOTE: Interactions with replicated state of their own (XRInteractionTrigger, XRInteractionGrab without physics) always replicate their owner.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|General")
+	bool bReplicateOwner = true;
+
+	// True if the owning Actor has to replicate for this Interaction to work over the network
+	virtual bool RequiresReplicatedOwner() const;
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Config - Spatial
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	/**
+	 * Detached removes this Interaction from the transform hierarchy at BeginPlay, so moving a grabbed Actor does not update it every frame.
+	 * Only the anchor (the former attach parent) is followed, when a location is actually needed (audio, hover distance, proxy placement).
+	 * The component transform is moved to the anchor when hovering and interacting starts, so the laser snap and Blueprints reading it then see the current pose.
+	 * Components attached below a Detached Interaction no longer follow the Actor.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Spatial")
+	EXRInteractionSpatialMode SpatialMode = EXRInteractionSpatialMode::Attached;
+
+	/**
+	 * Socket on the anchor the Interaction location is relative to while Detached.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Spatial", meta=(EditCondition="SpatialMode==EXRInteractionSpatialMode::Detached"))
+	FName AnchorSocket = NAME_None;
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Config - Proxy
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	/**
+	 * Spawn a simple query-only volume at BeginPlay that XRInteractors detect instead of the (potentially complex) collision of the Actors meshes.
+	 * The mesh collision keeps its own profile.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Proxy")
+	EXRInteractionProxyShape ProxyShape = EXRInteractionProxyShape::None;
+
+	/**
+	 * Sphere: X is the radius. Capsule: X is the radius, Z the half height. Box: the box extent.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Proxy", meta=(EditCondition="ProxyShape!=EXRInteractionProxyShape::None"))
+	FVector ProxyExtent = FVector(10.0f);
+
+	/**
+	 * Object channel of the proxy. It only overlaps this channel, XRInteractors using bOverlapInteractionProxiesOnly should use the same.
+	 * NOTE: Has to be a project channel (Project Settings -> Collision), no proxy is spawned on engine channels.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Proxy", meta=(EditCondition="ProxyShape!=EXRInteractionProxyShape::None"))
+	TEnumAsByte<ECollisionChannel> ProxyCollisionChannel = ECC_WorldDynamic;
+
+	UPROPERTY()
+	UShapeComponent* InteractionProxy = nullptr;
+
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// Config - Highlighting
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -227,6 +407,18 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Highlighting")
 	bool bEnableHighlighting = true;
 
+	/**
+	 * When to spawn the XRHighlight. OnFirstHover avoids caching meshes and setting up the fade for Interactions that are never hovered.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Highlighting", meta=(EditCondition="bEnableHighlighting"))
+	EXRHighlightCreation HighlightCreation = EXRHighlightCreation::OnBeginPlay;
+
+	/**
+	 * Seconds after the last hover ended until a lazily created XRHighlight is destroyed again. 0 keeps it alive.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Highlighting", meta=(EditCondition="bEnableHighlighting && HighlightCreation==EXRHighlightCreation::OnFirstHover", ClampMin="0.0"))
+	float HighlightIdleReleaseTime = 0.0f;
+
 	/**
 	 * Tags used to determine which MeshComponents to be used for Highlighting.
 	 * If none are specified, all UMeshComponents will be highlighted if a compatible material is assigned.
@@ -235,11 +427,21 @@ protected:
 	TArray<FName> HighlightIncludeOnlyTags = {};
 
 	/**
-	 * Fade the highlight based on this curve. If no curve is provided, HighlightState will be applied immediately.
+	 * Fade the highlight based on this curve. If not set, the DefaultHighlightFadeCurve of the XRCoreSettings is used.
+	 * Without any curve, HighlightState will be applied immediately.
 	 */
 	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Highlighting")
 	UCurveFloat* HighlightFadeCurve = nullptr;
 
+	/**
+	 * How the spawned XRHighlight writes its state. See XRHighlightComponent.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Highlighting")
+	EXRHighlightBackend HighlightBackend = EXRHighlightBackend::MaterialParameter;
+
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Highlighting", meta=(EditCondition="HighlightBackend==EXRHighlightBackend::CustomPrimitiveData", ClampMin="0"))
+	int32 HighlightCustomPrimitiveDataIndex = 0;
+
 	UPROPERTY()
 	UXRHighlightComponent* XRHighlightComponent = nullptr;
 
@@ -248,33 +450,63 @@ protected:
 	// Config - Audio
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	/**
-	* Played when the Interaction starts at the location of the XRInteractionComponent.
+	 * If true, unset Interaction sounds fall back to the XRCoreSettings defaults. Disable to keep an unset sound silent.
+	 */
+	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Audio")
+	bool bUseDefaultSounds = true;
+	/**
+	* Played when the Interaction starts at the location of the XRInteractionComponent. If not set, the XRCoreSettings default is played (see bUseDefaultSounds).
 	 */
 	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Audio")
 	USoundBase* InteractionStartSound= nullptr;
 	/**
-	* Played when the Interaction ends at the location of the XRInteractionComponent.
+	* Played when the Interaction ends at the location of the XRInteractionComponent. If not set, the XRCoreSettings default is played (see bUseDefaultSounds).
 	 */
 	UPROPERTY(EditAnywhere, Category = "XRCore|Interaction|Audio")
 	USoundBase* InteractionEndSound = nullptr;
 
-	UPROPERTY()
-	UAudioComponent* CurrentAudioComponent = nullptr;
+	// Pooled voice of the last played Interaction sound
+	FXRAudioHandle CurrentAudioHandle = {};
 
 	UFUNCTION()
 	void RequestAudioPlay(USoundBase* InSound);
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 private:
+	// True if the setting is read from the InteractionProfile
+	bool UsesProfileValue(EXRInteractionProfileOverride InSetting) const;
+	// Priority XRInteractors compare, resolved from the profile or this Interactions own settings
+	int32 ResolvedInteractionPriority = 1;
+	const TArray<FName>& GetHighlightIncludeOnlyTags() const;
+	UCurveFloat* GetHighlightFadeCurve() const;
+	USoundBase* GetInteractionStartSound() const;
+	USoundBase* GetInteractionEndSound() const;
+
 	UFUNCTION()
 	void SpawnAndConfigureXRHighlight();
+
+	void SpawnInteractionProxy();
+	void DestroyInteractionProxy();
+	// (Re-)register with the XRInteractionSubsystem under the current parents
+	void RegisterWithSubsystem();
+
+	void CaptureAnchor();
+	void DetachFromAnchor();
+	// Move a Detached Interaction to its current anchor pose
+	void SyncToAnchor();
+	TWeakObjectPtr<USceneComponent> AnchorComponent = nullptr;
+	// Relative transform to the anchor socket at the time of detaching
+	FTransform AnchorOffset = FTransform::Identity;
+
+	void ReleaseXRHighlight();
+	FTimerHandle HighlightReleaseTimer;
 	
 	UPROPERTY()
 	TArray<UMeshComponent*> InteractionCollision = {nullptr};
 	
-	UPROPERTY()
-	TArray<TWeakObjectPtr<UXRInteractorComponent>> ActiveInteractors = {};
+	FXRInteractionHandle InteractionHandle = {};
 
-	UPROPERTY()
-	TArray<TWeakObjectPtr<UXRInteractorComponent>> HoveringInteractors = {};
+	// XRInteractors remove themselves on EndPlay, so the membership is exact and the counts need no validation
+	TArray<FXRInteractorHandle, TInlineAllocator<2>> ActiveInteractorHandles = {};
+	TArray<FXRInteractorHandle, TInlineAllocator<2>> HoveringInteractorHandles = {};
 };
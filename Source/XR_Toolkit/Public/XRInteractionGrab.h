@@ -17,6 +17,7 @@ public:
 
     void StartInteraction(UXRInteractorComponent* InInteractor) override;
     void EndInteraction(UXRInteractorComponent* InInteractor) override;
+    void RollbackInteraction(UXRInteractorComponent* InInteractor) override;
 
 
     /**
@@ -45,6 +46,9 @@ public:
     bool HasPhysicsEnabled() const;
 
 protected:
+    // The non physics grab replicates the GrabActorTransform for late joiners
+    virtual bool RequiresReplicatedOwner() const override;
+
     UPROPERTY()
     UXRReplicatedPhysicsComponent* XRReplicatedPhysicsComponent = nullptr;
 
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UXRInteractionComponent;
+class UXRInteractorComponent;
+
+/**
+ * Index + generation reference to an XRInteraction or XRInteractor, issued by the XRInteractionSubsystem.
+ * Cheap to copy and compare. Stale once the referenced component ended play, as its slot is reused with a new generation.
+ */
+template<typename T>
+struct TXRHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Generation = 0; }
+
+	bool operator==(const TXRHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const TXRHandle& Other) const { return !(*this == Other); }
+	friend uint32 GetTypeHash(const TXRHandle& InHandle) { return HashCombine(::GetTypeHash(InHandle.Index), ::GetTypeHash(InHandle.Generation)); }
+};
+
+using FXRInteractionHandle = TXRHandle<UXRInteractionComponent>;
+using FXRInteractorHandle = TXRHandle<UXRInteractorComponent>;
+
+/**
+ * Slot storage behind TXRHandle. Released slots are reused, bumping their generation so older handles no longer resolve.
+ */
+template<typename T>
+class TXRHandleRegistry
+{
+public:
+	TXRHandle<T> Acquire(T* InObject)
+	{
+		int32 Index = INDEX_NONE;
+		if (FreeSlots.Num() > 0)
+		{
+			Index = FreeSlots.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			Index = Slots.AddDefaulted();
+		}
+		Slots[Index].Object = InObject;
+
+		TXRHandle<T> Handle;
+		Handle.Index = Index;
+		Handle.Generation = Slots[Index].Generation;
+		return Handle;
+	}
+
+	void Release(const TXRHandle<T>& InHandle)
+	{
+		if (!Slots.IsValidIndex(InHandle.Index) || Slots[InHandle.Index].Generation != InHandle.Generation)
+		{
+			return;
+		}
+		FSlot& Slot = Slots[InHandle.Index];
+		Slot.Object.Reset();
+		// 0 is reserved for invalid handles
+		Slot.Generation = Slot.Generation == MAX_uint32 ? 1 : Slot.Generation + 1;
+		FreeSlots.Add(InHandle.Index);
+	}
+
+	T* Resolve(const TXRHandle<T>& InHandle) const
+	{
+		if (!Slots.IsValidIndex(InHandle.Index) || Slots[InHandle.Index].Generation != InHandle.Generation)
+		{
+			return nullptr;
+		}
+		return Slots[InHandle.Index].Object.Get();
+	}
+
+	void Empty()
+	{
+		Slots.Empty();
+		FreeSlots.Empty();
+	}
+
+private:
+	struct FSlot
+	{
+		TWeakObjectPtr<T> Object;
+		uint32 Generation = 1;
+	};
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+};
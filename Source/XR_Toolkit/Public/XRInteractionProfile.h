@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "XRInteractionComponent.h"
+#include "XRInteractionProfile.generated.h"
+
+class UCurveFloat;
+class USoundBase;
+
+/**
+ * Settings of an XRInteractionProfile an XRInteractionComponent overrides with its own value.
+ */
+UENUM(BlueprintType, meta=(Bitflags, UseEnumValuesAsMaskValuesInEditor="true"))
+enum class EXRInteractionProfileOverride : uint8
+{
+	None = 0 UMETA(Hidden),
+	InteractionPriority = 1 << 0 UMETA(DisplayName = "Interaction Priority"),
+	MultiInteractorBehavior = 1 << 1 UMETA(DisplayName = "Multi Interactor Behavior"),
+	LaserBehavior = 1 << 2 UMETA(DisplayName = "Laser Behavior"),
+	HighlightIncludeOnlyTags = 1 << 3 UMETA(DisplayName = "Highlight Include Only Tags"),
+	HighlightFadeCurve = 1 << 4 UMETA(DisplayName = "Highlight Fade Curve"),
+	InteractionStartSound = 1 << 5 UMETA(DisplayName = "Interaction Start Sound"),
+	InteractionEndSound = 1 << 6 UMETA(DisplayName = "Interaction End Sound"),
+};
+ENUM_CLASS_FLAGS(EXRInteractionProfileOverride);
+
+/**
+ * Shared configuration for a category of XRInteractionComponents (iE. all grabbable props).
+ * Interactions referencing a profile read these values unless they override them, so a whole category can be retuned in one asset.
+ */
+UCLASS(BlueprintType)
+class XR_TOOLKIT_API UXRInteractionProfile : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * See XRInteractionComponent.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|General")
+	EXRInteractionPriority InteractionPriority = EXRInteractionPriority::Primary;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|General", meta = (ClampMin = "0", EditCondition="InteractionPriority==EXRInteractionPriority::Custom"))
+	int32 AbsolouteInteractionPriority = 1;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|General")
+	EXRMultiInteractorBehavior MultiInteractorBehavior = EXRMultiInteractorBehavior::TakeOver;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|General")
+	EXRLaserBehavior LaserBehavior = EXRLaserBehavior::Snap;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|Highlighting")
+	TArray<FName> HighlightIncludeOnlyTags = {};
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|Highlighting")
+	UCurveFloat* HighlightFadeCurve = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|Audio")
+	USoundBase* InteractionStartSound = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "XRCore|Interaction|Audio")
+	USoundBase* InteractionEndSound = nullptr;
+
+	/**
+	 * Resolve the Priority enum to the value XRInteractors compare. Lower values are started first.
+	 */
+	static int32 ResolveInteractionPriority(EXRInteractionPriority InInteractionPriority, int32 InAbsolouteInteractionPriority);
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "XRInteractionHandle.h"
+#include "XRInteractionSubsystem.generated.h"
+
+class UXRInteractionComponent;
+class UXRInteractorComponent;
+class UPrimitiveComponent;
+
+/**
+ * World-level registry of all XRInteractionComponents.
+ * Maps each PrimitiveComponent to the XRInteractions attached below it (including those of Actors attached below it) and each Actor to its XRInteractions,
+ * so XRInteractors can resolve interaction candidates for an overlapped component with a single lookup.
+ * Kept up to date by the XRInteractionComponents themselves on register / unregister, BeginPlay and whenever they are re-attached.
+ * Actor attachment changes do not notify the components of the attached Actor, these go through RefreshActorInteractions.
+ * Also issues the handles XRInteractions and XRInteractors use to track hover and interaction membership of each other.
+ */
+UCLASS()
+class XR_TOOLKIT_API UXRInteractionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	using FInteractionList = TArray<UXRInteractionComponent*, TInlineAllocator<4>>;
+
+	virtual void Deinitialize() override;
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Registration
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	/**
+	 * Register an Interaction with all PrimitiveComponents it is attached to (on its owning Actor) and with its owning Actor.
+	 * NOTE: Called by XRInteractionComponent::OnRegister and OnAttachmentChanged.
+	 */
+	void RegisterInteraction(UXRInteractionComponent* InInteraction);
+
+	/**
+	 * Register the proxy volume of an Interaction, so overlapping the proxy resolves to the Interaction. Removed by UnregisterInteraction.
+	 * NOTE: Called by XRInteractionComponent when the proxy is spawned and on re-registration.
+	 */
+	void RegisterInteractionProxy(UXRInteractionComponent* InInteraction, UPrimitiveComponent* InProxy);
+
+	/**
+	 * Remove the proxy volume of an Interaction, the Interaction itself stays registered.
+	 * NOTE: Called by XRInteractionComponent before the proxy is destroyed.
+	 */
+	void UnregisterInteractionProxy(UXRInteractionComponent* InInteraction, UPrimitiveComponent* InProxy);
+
+	/**
+	 * Register the Interactions of the Actor and of all Actors attached to it again, under their current parents.
+	 * NOTE: Called by XRInteractionGrab when it attaches / detaches its Actor. Call after attaching or detaching an Actor with Interactions elsewhere.
+	 */
+	void RefreshActorInteractions(AActor* InActor);
+
+	/**
+	 * Remove an Interaction from all lookups it was registered with.
+	 * NOTE: Called by XRInteractionComponent::OnUnregister.
+	 */
+	void UnregisterInteraction(UXRInteractionComponent* InInteraction);
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Handles
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	/**
+	 * Issue a handle for the component. Released handles no longer resolve, even after their slot is reused.
+	 * NOTE: Called by XRInteractionComponent / XRInteractorComponent on BeginPlay and EndPlay.
+	 */
+	FXRInteractionHandle AcquireInteractionHandle(UXRInteractionComponent* InInteraction);
+	void ReleaseInteractionHandle(const FXRInteractionHandle& InHandle);
+	FXRInteractorHandle AcquireInteractorHandle(UXRInteractorComponent* InInteractor);
+	void ReleaseInteractorHandle(const FXRInteractorHandle& InHandle);
+
+	/**
+	 * Return the component of the handle, nullptr if the handle is stale.
+	 */
+	UXRInteractionComponent* ResolveInteraction(const FXRInteractionHandle& InHandle) const;
+	UXRInteractorComponent* ResolveInteractor(const FXRInteractorHandle& InHandle) const;
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Lookup
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	/**
+	 * Gather all Interactions attached below the given PrimitiveComponent, including the Interactions of Actors attached below it.
+	 * Mirrors GetChildrenComponents(true) of the component. Resets OutInteractions, no allocation unless more than 4 Interactions are found.
+	 */
+	void GetInteractionsForComponent(const UPrimitiveComponent* InComponent, FInteractionList& OutInteractions) const;
+
+	/**
+	 * Changes whenever an Interaction registers or unregisters, lookups cached by the caller are stale once it differs.
+	 */
+	uint32 GetRegistryGeneration() const { return RegistryGeneration; }
+
+	/**
+	 * Return all Interactions owned by the given Actor. Empty if there are none.
+	 * The returned view is only valid until the next Interaction registers or unregisters.
+	 */
+	TArrayView<UXRInteractionComponent* const> GetInteractionsForActor(const AActor* InActor) const;
+
+	/**
+	 * Convenience accessor, returns nullptr if the World has no XRInteractionSubsystem (iE. during teardown).
+	 */
+	static UXRInteractionSubsystem* Get(const UObject* InWorldContextObject);
+
+private:
+	TMap<TObjectKey<UPrimitiveComponent>, FInteractionList> InteractionsByComponent;
+	TMap<TObjectKey<AActor>, FInteractionList> InteractionsByActor;
+
+	// Reverse lookup, so unregistering is exact even if the attachment changed after registration
+	TMap<TObjectKey<UXRInteractionComponent>, TArray<TObjectKey<UPrimitiveComponent>, TInlineAllocator<2>>> ComponentsByInteraction;
+	TMap<TObjectKey<UXRInteractionComponent>, TObjectKey<AActor>> ActorByInteraction;
+	uint32 RegistryGeneration = 0;
+
+	TXRHandleRegistry<UXRInteractionComponent> InteractionHandles;
+	TXRHandleRegistry<UXRInteractorComponent> InteractorHandles;
+};
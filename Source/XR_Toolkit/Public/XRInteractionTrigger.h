@@ -16,6 +16,7 @@ enum class EXRInteractionTriggerBehavior : uint8
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnTriggerStateChanged, UXRInteractionTrigger*, Sender, bool, TriggerState, UXRInteractorComponent*, Interactor);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnTriggerStateChangedNative, UXRInteractionTrigger*, bool, UXRInteractorComponent*);
 
 UCLASS(ClassGroup = (XRToolkit), meta = (BlueprintSpawnableComponent))
 class XR_TOOLKIT_API UXRInteractionTrigger : public UXRInteractionComponent
@@ -33,6 +34,7 @@ public:
 
     UPROPERTY(BlueprintAssignable, Category = "XRCore|Interaction")
     FOnTriggerStateChanged OnTriggerStateChanged;
+    FOnTriggerStateChangedNative OnTriggerStateChangedNative;
 
     /**
     * Set the state of the Trigger. Replicated if called with authority.
@@ -71,6 +73,9 @@ public:
     // ------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 protected:
+    // bTriggerState replicates through this component
+    virtual bool RequiresReplicatedOwner() const override;
+
     /**
     * Trigger Behavior
     * Trigger: Single Interaction that ends and returns to DefaultState after InteractionDuration
@@ -82,6 +87,7 @@ protected:
 
     UFUNCTION(Server, Reliable)
     void Server_SetTriggerState(bool InTriggerState, UXRInteractorComponent* InInteractor);
+    void SetTriggerStateWithAuthority(bool InTriggerState, UXRInteractorComponent* InInteractor);
 
     /**
     * If this is a OneShot Trigger, the Interaction will be terminated after this duration (in seconds).
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "XRInteractorBatchSubsystem.generated.h"
+
+class UXRInteractorComponent;
+class UXRInteractionComponent;
+
+/**
+ * Evaluates the hover candidates of all XRInteractors using batched hover evaluation once per frame, after physics.
+ * Candidates are gathered into plain data on the game thread, scored in parallel and the resulting hover changes applied on the game thread again.
+ * Interactors are scored once marked dirty and then every frame for as long as they overlap anything.
+ */
+UCLASS()
+class XR_TOOLKIT_API UXRInteractorBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Request a re-evaluation of the Interactors hovered Interactions during the next batch.
+	 * NOTE: Called by XRInteractor whenever its overlaps or active Interactions change.
+	 */
+	void MarkHoverDirty(UXRInteractorComponent* InInteractor);
+
+	/**
+	 * Convenience accessor, returns nullptr if the World has no XRInteractorBatchSubsystem (iE. during teardown).
+	 */
+	static UXRInteractorBatchSubsystem* Get(const UObject* InWorldContextObject);
+
+private:
+	struct FHoverCandidate
+	{
+		// Index into CandidateInteractions
+		int32 InteractionIndex = INDEX_NONE;
+		// Candidates of the same overlapped component share a group, at most one Interaction per group is hovered
+		int32 GroupIndex = INDEX_NONE;
+		int32 Priority = 0;
+		float DistanceSquared = 0.0f;
+	};
+
+	struct FHoverJob
+	{
+		UXRInteractorComponent* Interactor = nullptr;
+		int32 FirstCandidate = 0;
+		int32 NumCandidates = 0;
+		TArray<int32, TInlineAllocator<4>> SelectedInteractions;
+	};
+
+	void GatherJobs();
+	static void ScoreJob(FHoverJob& InOutJob, TArrayView<const FHoverCandidate> InCandidates);
+	void ApplyJob(const FHoverJob& InJob);
+
+	// Marked dirty plus all Interactors that still overlap something
+	TSet<TWeakObjectPtr<UXRInteractorComponent>> DirtyInteractors;
+
+	// Scratch buffers, reused every frame
+	TArray<FHoverJob> Jobs;
+	TArray<FHoverCandidate> Candidates;
+	TArray<UXRInteractionComponent*> CandidateInteractions;
+};
@@ -5,7 +5,10 @@
 #include "Components/SphereComponent.h"
 #include "InputCoreTypes.h"
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "WorldCollision.h"
 #include "XRToolsUtilityFunctions.h"
+#include "XRInteractionHandle.h"
 #include "XRInteractorComponent.generated.h"
 
 class UXRInteractionComponent;
@@ -25,7 +28,7 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "XRCore|XRInteraction")
 	void StartInteraction(UXRInteractorComponent* InInteractor, UXRInteractionComponent* InInteraction);
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "XRCore|XRInteraction")
-	void StartInteractionByPriority(int32 InPriority = 1, EXRInteractionPrioritySelection InPrioritySelectionCondition = EXRInteractionPrioritySelection::LowerEqual);
+	void StartInteractionByPriority(int32 InPriority = 0, EXRInteractionPrioritySelection InPrioritySelectionCondition = EXRInteractionPrioritySelection::LowerEqual);
 
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "XRCore|XRInteraction")
 	void StopInteraction(UXRInteractorComponent* InInteractor, UXRInteractionComponent* InInteraction);
@@ -39,9 +42,125 @@ public:
 	void HoverInteraction(UXRInteractorComponent* InInteractor, UXRInteractionComponent* InInteraction, bool InHoverState);
 };
 
+UENUM(BlueprintType)
+enum class EXRInteractorQueryMode : uint8
+{
+	OverlapEvents UMETA(DisplayName = "Overlap Events", ToolTip = "Candidates are tracked through Begin/EndOverlap events, requires GenerateOverlapEvents on Interactables."),
+	AsyncQuery UMETA(DisplayName = "Async Query", ToolTip = "Candidates are queried periodically on the QueryChannel, Interactables do not need to generate overlap events."),
+};
+
+UENUM()
+enum class EXRInteractionCommandType : uint8
+{
+	Start,
+	Stop,
+	TakeOver,
+};
+
+/**
+ * A single start / stop / takeover intent. Collected by the XRInteractor during a frame and sent to the server as one batch.
+ */
+USTRUCT()
+struct FXRInteractionCommand
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	EXRInteractionCommandType Type = EXRInteractionCommandType::Start;
+
+	UPROPERTY()
+	UXRInteractionComponent* Interaction = nullptr;
+
+	/**
+	 * Non-zero if the owning client already started this Interaction locally and expects a confirmation / rejection.
+	 */
+	UPROPERTY()
+	uint16 PredictionKey = 0;
+};
+
+/**
+ * Server response to a predicted Interaction start. Sent again with bEnded once the server ends the Interaction, which may happen
+ * before its start ever replicated (iE. a quick press / release within one net update).
+ */
+USTRUCT()
+struct FXRInteractionPredictionResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint16 PredictionKey = 0;
+
+	UPROPERTY()
+	bool bAccepted = false;
+
+	UPROPERTY()
+	bool bEnded = false;
+};
+
+/**
+ * One Interaction an XRInteractor is active on. Replicated as a delta, clients start / end the Interaction from the add / remove callbacks.
+ */
+USTRUCT()
+struct FXRActiveInteractionItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UXRInteractionComponent* Interaction = nullptr;
+
+	// Whether StartInteraction already ran on this machine for this item. Interactions on Actors that are not yet replicated resolve later.
+	UPROPERTY(NotReplicated)
+	bool bApplied = false;
+
+	void PostReplicatedAdd(const struct FXRActiveInteractionArray& InArraySerializer);
+	void PostReplicatedChange(const struct FXRActiveInteractionArray& InArraySerializer);
+	void PreReplicatedRemove(const struct FXRActiveInteractionArray& InArraySerializer);
+};
+
+/**
+ * Authoritative set of Interactions an XRInteractor is active on.
+ * NOTE: Only modified on the server, clients (including late joiners) follow through the replication callbacks.
+ */
+USTRUCT()
+struct FXRActiveInteractionArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FXRActiveInteractionItem> Items;
+
+	UPROPERTY(NotReplicated)
+	UXRInteractorComponent* OwningInteractor = nullptr;
+
+	// [Server] Returns false if the Interaction was already contained
+	bool AddInteraction(UXRInteractionComponent* InInteraction);
+	// [Server] Returns false if the Interaction was not contained
+	bool RemoveInteraction(UXRInteractionComponent* InInteraction);
+
+	bool Contains(const UXRInteractionComponent* InInteraction) const;
+	bool IsEmpty() const { return Items.IsEmpty(); }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FXRActiveInteractionItem, FXRActiveInteractionArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FXRActiveInteractionArray> : public TStructOpsTypeTraitsBase2<FXRActiveInteractionArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStartedInteracting, UXRInteractorComponent*, Sender, UXRInteractionComponent*, XRInteractionComponent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStoppedInteracting, UXRInteractorComponent*, Sender, UXRInteractionComponent*, XRInteractionComponent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnHoverStateChanged, UXRInteractorComponent*, Sender, UXRInteractionComponent*, HoveredXRInteractionComponent, bool, bHoverState);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnStartedInteractingNative, UXRInteractorComponent*, UXRInteractionComponent*);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnStoppedInteractingNative, UXRInteractorComponent*, UXRInteractionComponent*);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnHoverStateChangedNative, UXRInteractorComponent*, UXRInteractionComponent*, bool);
 
 UCLASS( ClassGroup=(XRToolkit), meta=(BlueprintSpawnableComponent) )
 class XR_TOOLKIT_API UXRInteractorComponent : public USphereComponent
@@ -65,12 +184,14 @@ public:
 	 * Start interacting with the next available XRInteractionComponent. 
 	 * Will interact with the most prioritized interaction on the closest found actor with an XRInteractionComponent OR the most prioritized interaction on the actor 
 	 * that is already being interacted with (using multiple interactions on one Actor).
+	 * The defaults select from all priorities, like GetXRInteractionByPriority.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "XRCore|Interactor")
-	void StartXRInteractionByPriority(int32 InPriority = 1, EXRInteractionPrioritySelection InPrioritySelectionCondition = EXRInteractionPrioritySelection::LowerEqual);
+	void StartXRInteractionByPriority(int32 InPriority = 0, EXRInteractionPrioritySelection InPrioritySelectionCondition = EXRInteractionPrioritySelection::LowerEqual);
 
 	UPROPERTY(BlueprintAssignable, Category = "XRCore|Interactor|Delegates")
 	FOnStartedInteracting OnStartedInteracting;
+	FOnStartedInteractingNative OnStartedInteractingNative;
 
 	/**
 	 * Will stop the specified Interaction.
@@ -94,9 +215,18 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category = "XRCore|Interactor|Delegates")
 	FOnStoppedInteracting OnStoppedInteracting;
+	FOnStoppedInteractingNative OnStoppedInteractingNative;
+
+	/**
+	 * On remote clients Start / Stop requests are collected during the frame and sent to the server in a single RPC at the end of the frame.
+	 * Call this to send all queued requests immediately instead. Server and standalone execute requests immediately, nothing is queued there.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "XRCore|Interactor")
+	void FlushInteractionCommands();
 	
 	UPROPERTY(BlueprintAssignable, Category = "XRCore|Interactor|Delegates")
 	FOnHoverStateChanged OnHoverStateChanged;
+	FOnHoverStateChangedNative OnHoverStateChangedNative;
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// Utility
@@ -126,6 +256,12 @@ public:
 	UFUNCTION(BlueprintPure, Category="XRCore|Interactor")
 	TArray<UXRInteractionComponent*> GetOverlappedXRInteractions() const;
 
+	/**
+	 * Native version of GetOverlappedXRInteractions. The list is built at most once per frame and reused until the overlaps or active Interactions change.
+	 * The returned view is only valid until the next overlap change.
+	 */
+	TArrayView<UXRInteractionComponent* const> GetOverlappedXRInteractionsView() const;
+
 
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// Config
@@ -146,7 +282,18 @@ public:
 	 * coming from Hands or Lasers to allow for different behavior. (For example SnapToHand-grab via Laser) 
 	*/
 	UFUNCTION(BlueprintPure, Category="XRCore|Interactor")
-	bool IsLaserInteractor();
+	bool IsLaserInteractor() const;
+
+	/**
+	 * Handle issued by the XRInteractionSubsystem during play. Invalid before BeginPlay.
+	 */
+	FXRInteractorHandle GetInteractorHandle() const;
+
+	/**
+	 * Drop the XRInteraction from the hover state without any events.
+	 * NOTE: Called by XRInteraction on EndPlay.
+	 */
+	void RemoveHoveredInteraction(const FXRInteractionHandle& InInteractionHandle);
 
 	/**
 	 * Manually set the assochiated Pawn - this is useful for Actors that need a XRInteractor but are not an APawn like the XRLaser.
@@ -200,6 +347,8 @@ public:
 protected:
 	virtual void InitializeComponent() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	UFUNCTION()
 	TArray<UXRInteractionComponent*> GetChildXRInteractionComponents(UPrimitiveComponent* InComponent);
@@ -213,24 +362,107 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor")
 	bool bIsLaserInteractor = false;
 
+	/**
+	 * If true, the owning client starts Interactions locally right away instead of waiting for the server round trip.
+	 * Interactions the server rejects are rolled back (hover, highlight, attachment and audio).
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor")
+	bool bPredictInteractionStart = false;
+
+	/**
+	 * How this Interactor finds Interaction candidates.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor|Query")
+	EXRInteractorQueryMode QueryMode = EXRInteractorQueryMode::OverlapEvents;
+
+	/**
+	 * Channel the Interactor colliders are queried on in AsyncQuery mode.
+	 * The default WorldDynamic matches every movable object in range. To reduce the query cost, add a trace channel under Project Settings > Collision
+	 * (default response Ignore), set it to Overlap on the Interactable meshes / collision profiles and select it here. Warns on BeginPlay otherwise.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor|Query", meta=(EditCondition="QueryMode==EXRInteractorQueryMode::AsyncQuery"))
+	TEnumAsByte<ECollisionChannel> QueryChannel = ECC_WorldDynamic;
+
+	/**
+	 * Seconds between hover refreshes in AsyncQuery mode. Start requests always query immediately.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor|Query", meta=(EditCondition="QueryMode==EXRInteractorQueryMode::AsyncQuery", ClampMin="0.0"))
+	float HoverQueryInterval = 0.05f;
+
+	/**
+	 * If true, hover candidates are scored by the XRInteractorBatchSubsystem once per frame together with all other batched Interactors,
+	 * instead of immediately on every overlap change.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor|Query")
+	bool bUseBatchedHoverEvaluation = false;
+
+	/**
+	 * If true, only Interaction proxy volumes on InteractionProxyChannel are detected. The collision of this Interactor and its AdditionalColliders is left untouched,
+	 * query-only shapes matching them overlap the proxy channel instead (AsyncQuery mode queries the channel directly).
+	 * NOTE: Only Interactions with a ProxyShape on the same channel can be interacted with.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor|Query")
+	bool bOverlapInteractionProxiesOnly = false;
+
+	/**
+	 * Has to be a project channel (Project Settings -> Collision) that nothing but the proxies uses, bOverlapInteractionProxiesOnly is ignored on engine channels.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="XRCore|Interactor|Query", meta=(EditCondition="bOverlapInteractionProxiesOnly"))
+	TEnumAsByte<ECollisionChannel> InteractionProxyChannel = ECC_WorldDynamic;
+
 	UFUNCTION()
 	void RequestHover(UXRInteractionComponent* InInteraction, bool bInHoverState);
 
+	/**
+	 * Returns true if this Interactor or any of its AdditionalColliders is currently overlapping the given component.
+	 */
 	UFUNCTION()
-	bool IsAnyColliderOverlappingComponent(UPrimitiveComponent* InComponent, bool IgnoreSelf);
+	bool IsAnyColliderOverlappingComponent(UPrimitiveComponent* InComponent) const;
 
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Command Buffer
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	void QueueInteractionCommand(EXRInteractionCommandType InType, UXRInteractionComponent* InInteractionComponent, uint16 InPredictionKey = 0);
+
+	/**
+	 * Applies all commands of one frame in order, including terminating other XRInteractors on TakeOver.
+	 */
 	UFUNCTION(Server, Reliable, Category = "XRCore|Interactor")
-	void Server_ExecuteInteraction(UXRInteractionComponent* InInteractionComponent);
-	UFUNCTION(NetMulticast, Reliable, Category = "XRCore|Interactor")
-	void Multicast_ExecuteInteraction(UXRInteractionComponent* InteractionComponent);
+	void Server_ExecuteInteractionCommands(const TArray<FXRInteractionCommand>& InCommands);
+	void ExecuteInteractionCommand(const FXRInteractionCommand& InCommand);
 
+	// [Server] Validate and start / stop a single Interaction. 
+	bool ExecuteInteraction(UXRInteractionComponent* InInteractionComponent);
+	void TerminateInteraction(UXRInteractionComponent* InInteractionComponent);
+
+	// Local start / end of an Interaction on this machine, shared by the server, the replication callbacks and Prediction
+	void ApplyInteractionStart(UXRInteractionComponent* InInteractionComponent);
+	void ApplyInteractionEnd(UXRInteractionComponent* InInteractionComponent);
+	// Re-hover an Interaction that stopped being active if it is still overlapped
+	void RestoreHover(UXRInteractionComponent* InInteractionComponent);
+
+	// [Client] Called by FXRActiveInteractionArray
+	friend struct FXRActiveInteractionItem;
+	void OnActiveInteractionReplicated(UXRInteractionComponent* InInteractionComponent);
+	void OnActiveInteractionRemoved(UXRInteractionComponent* InInteractionComponent);
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Prediction
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	bool ShouldPredictInteraction(UXRInteractionComponent* InInteractionComponent) const;
+	// Queue a Stop, ending a still predicted Interaction locally right away
+	void QueueStopInteraction(UXRInteractionComponent* InInteractionComponent);
+	void ReconcileEndedPrediction(uint16 InPredictionKey);
+	// [Server] Send the collected results, unless a command batch is being executed which sends them at its end
+	void FlushPredictionResults();
+
+	UFUNCTION(Client, Reliable, Category = "XRCore|Interactor")
+	void Client_ReconcilePredictions(const TArray<FXRInteractionPredictionResult>& InResults);
 
-	UFUNCTION(Server, Reliable, Category = "XRCore|Interactor")
-	void Server_TerminateInteraction(UXRInteractionComponent* InInteractionComponent);
-	UFUNCTION(NetMulticast, Reliable, Category = "XRCore|Interactor")
-	void Multicast_TerminateInteraction(UXRInteractionComponent* InteractionComponent);
 	
 private:
+	friend class UXRInteractorBatchSubsystem;
+
 	UPROPERTY()
 	APawn* OwningPawn = nullptr;
 	UPROPERTY()
@@ -238,13 +470,79 @@ private:
 	UPROPERTY()
 	AActor* LocalInteractedActor = nullptr;
 	UPROPERTY(Replicated)
-	TArray<TWeakObjectPtr<UXRInteractionComponent>> ActiveInteractionComponents = {};
+	FXRActiveInteractionArray ActiveInteractionComponents;
+	FXRInteractorHandle InteractorHandle = {};
+	// Interactions remove themselves on EndPlay, so no handle outlives its Interaction
+	TArray<FXRInteractionHandle, TInlineAllocator<4>> HoveredInteractionHandles = {};
 	UPROPERTY()
-	TArray<TWeakObjectPtr<UXRInteractionComponent>> HoveredInteractionComponents = {};
+	TArray<FXRInteractionCommand> PendingInteractionCommands = {};
+
+	// Interactions started locally that are not yet confirmed by the server, with their PredictionKey
+	TMap<TWeakObjectPtr<UXRInteractionComponent>, uint16> PredictedInteractions = {};
+	// Predicted Interactions already stopped locally, their replicated start / end is swallowed until the server ended them
+	TMap<TWeakObjectPtr<UXRInteractionComponent>, uint16> PredictedStops = {};
+	uint16 LastPredictionKey = 0;
+
+	// [Server] PredictionKey of each Interaction started by a prediction of the owning client, reported back with bEnded once it ends
+	TMap<TObjectKey<UXRInteractionComponent>, uint16> ServerPredictionKeys = {};
+	TArray<FXRInteractionPredictionResult> PendingPredictionResults = {};
+	bool bExecutingInteractionCommands = false;
 
 	void CacheIsLocallyControlled();
 	bool bIsLocallyControlled = false;
 
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Overlap Table
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	/**
+	 * Number of colliders (self and AdditionalColliders) overlapping each component. Updated from Begin/EndOverlap events or, in AsyncQuery mode, from query results.
+	 */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, int32> OverlapCounts = {};
+
+	void AddOverlap(UPrimitiveComponent* InComponent);
+	void RemoveOverlap(UPrimitiveComponent* InComponent);
+	void OnComponentOverlapStarted(UPrimitiveComponent* InComponent);
+	void OnComponentOverlapEnded(UPrimitiveComponent* InComponent);
+	void RebuildOverlapTable();
+	void InvalidateOverlappedInteractions();
+
+	// Cache for GetOverlappedXRInteractionsView, valid until the overlaps or the XRInteractionSubsystem registry change
+	mutable TArray<UXRInteractionComponent*> CachedOverlappedInteractions = {};
+	mutable uint32 CachedOverlappedInteractionsGeneration = 0;
+	mutable bool bOverlappedInteractionsValid = false;
+	bool DeferHoverToBatch();
+	// Diff the given counts against the current table, starting / ending hovers for changed components
+	void ApplyOverlapCounts(TMap<TWeakObjectPtr<UPrimitiveComponent>, int32>&& InOverlapCounts);
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Async Query
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	bool IsUsingAsyncQuery() const;
+	ECollisionChannel GetQueryChannel() const;
+	bool IsOverlappingInteractionProxiesOnly() const;
+	TArray<UPrimitiveComponent*, TInlineAllocator<4>> GetQueryColliders();
+	// Colliders whose overlap events feed the overlap table, the proxy sensors in proxy-only mode
+	TArray<UPrimitiveComponent*, TInlineAllocator<4>> GetOverlapEventColliders();
+	void RebuildProxySensors();
+	void DestroyProxySensors();
+	UShapeComponent* CreateProxySensor(UPrimitiveComponent* InCollider);
+
+	// Query-only shapes following the query colliders, only overlapping InteractionProxyChannel
+	UPROPERTY()
+	TArray<UShapeComponent*> ProxySensors = {};
+	// Run the query synchronously and apply it, used right before starting Interactions
+	void RefreshOverlapsImmediate();
+	void IssueAsyncOverlapQuery();
+	void OnAsyncOverlapQueryCompleted(const FTraceHandle& InTraceHandle, FOverlapDatum& InOverlapDatum);
+
+	FTimerHandle HoverQueryTimer;
+	FOverlapDelegate AsyncOverlapDelegate;
+	// Results of the in-flight query, one async overlap per collider
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, int32> PendingQueryCounts = {};
+	int32 PendingQueryResults = 0;
+	// Incremented per query, results of outdated queries (iE. after an immediate refresh) are dropped
+	uint32 QuerySerial = 0;
+
 	UFUNCTION()
 	void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
 		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -50,6 +50,8 @@ public:
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnXRLaserSpawned, UXRLaserComponent*, Sender, bool, SpawnResult);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnXRLaserStateChanged, UXRLaserComponent*, Sender, bool, NewState);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnXRLaserSpawnedNative, UXRLaserComponent*, bool);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnXRLaserStateChangedNative, UXRLaserComponent*, bool);
 
 UCLASS(Blueprintable, ClassGroup = (XRToolkit), meta = (BlueprintSpawnableComponent))
 class XR_TOOLKIT_API UXRLaserComponent : public USceneComponent, public IXRLaserInterface, public IXRInteractionInterface
@@ -78,8 +80,10 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category = "XRCore|XRLaser")
 	FOnXRLaserSpawned OnXRLaserSpawned;
+	FOnXRLaserSpawnedNative OnXRLaserSpawnedNative;
 	UPROPERTY(BlueprintAssignable, Category = "XRCore|XRLaser")
 	FOnXRLaserStateChanged OnXRLaserStateChanged;
+	FOnXRLaserStateChangedNative OnXRLaserStateChangedNative;
 
 
 protected:
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
+#include "XRReplicatedPhysicsComponent.h"
+#include "XRPhysicsReplicationManager.generated.h"
+
+class APlayerController;
+
+/**
+ * Latest Snapshot of one body replicated through an XRPhysicsReplicationManager. Clients hand it to the body from the replication callbacks.
+ */
+USTRUCT()
+struct FXRPhysicsBodyItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UXRReplicatedPhysicsComponent* Body = nullptr;
+
+	UPROPERTY()
+	FXRPhysicsSnapshot Snapshot;
+
+	void PostReplicatedAdd(const struct FXRPhysicsBodyArray& InArraySerializer);
+	void PostReplicatedChange(const struct FXRPhysicsBodyArray& InArraySerializer);
+};
+
+/**
+ * Snapshots of all bodies of one XRPhysicsReplicationManager, only the items changed since the last update are sent.
+ * NOTE: Only modified on the server.
+ */
+USTRUCT()
+struct FXRPhysicsBodyArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FXRPhysicsBodyItem> Items;
+
+	// [Server] Returns false if the body was already contained
+	bool AddBody(UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot);
+	// [Server] Returns false if the body was not contained
+	bool UpdateBody(const UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot);
+	// [Server] Returns false if the body was not contained
+	bool RemoveBody(const UXRReplicatedPhysicsComponent* InBody);
+
+	const FXRPhysicsSnapshot* FindSnapshot(const UXRReplicatedPhysicsComponent* InBody) const;
+
+	int32 Num() const { return Items.Num(); }
+
+	// [Server] True while items were changed that no connection was sent yet
+	bool HasUnsentChanges() const { return bHasUnsentChanges; }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		if (DeltaParms.Writer)
+		{
+			bHasUnsentChanges = false;
+		}
+		return FFastArraySerializer::FastArrayDeltaSerialize<FXRPhysicsBodyItem, FXRPhysicsBodyArray>(Items, DeltaParms, *this);
+	}
+
+private:
+	bool bHasUnsentChanges = false;
+
+	// [Server] Index of each bodies item
+	TMap<TObjectKey<UXRReplicatedPhysicsComponent>, int32> ItemIndices;
+};
+
+template<>
+struct TStructOpsTypeTraits<FXRPhysicsBodyArray> : public TStructOpsTypeTraitsBase2<FXRPhysicsBodyArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Replicates the Snapshots of many XRReplicatedPhysicsComponents through a single Actor channel, so their owning Actors do not need to replicate.
+ * The XRPhysicsReplicationSubsystem spawns one per level on demand, which is always relevant. More can be placed to split large levels into regions
+ * (see XRReplicatedPhysicsComponent::ReplicationManager), these are only relevant to players within their NetCullDistanceSquared, so place them in the center of their region.
+ * With XRCoreSettings::bSchedulePhysicsPerConnection it instead spawns one per connection, only relevant to its owning PlayerController.
+ */
+UCLASS(ClassGroup=(XRToolkit))
+class XR_TOOLKIT_API AXRPhysicsReplicationManager : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AXRPhysicsReplicationManager();
+
+	/**
+	 * [Server] Start / stop replicating the body.
+	 * NOTE: Called by XRPhysicsReplicationSubsystem when a body registers / unregisters.
+	 */
+	void AddBody(UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot);
+	void RemoveBody(const UXRReplicatedPhysicsComponent* InBody);
+
+	/**
+	 * [Server] Replicate a new Snapshot of the body with the next net update.
+	 */
+	void UpdateBody(const UXRReplicatedPhysicsComponent* InBody, const FXRPhysicsSnapshot& InSnapshot);
+
+	/**
+	 * [Server] The Snapshot of the body that was last handed to this manager, nullptr if the body was not added.
+	 */
+	const FXRPhysicsSnapshot* FindSnapshot(const UXRReplicatedPhysicsComponent* InBody) const;
+
+	/**
+	 * [Server] Only replicate to the connection of the PlayerController.
+	 */
+	void SetConnectionOwner(APlayerController* InPlayerController);
+
+	/**
+	 * [Server] True while changed Snapshots wait for the next net update.
+	 */
+	bool HasUnsentChanges() const;
+
+	/**
+	 * Number of bodies replicated through this manager.
+	 */
+	UFUNCTION(BlueprintPure, Category = "XRCore|Physics Replication")
+	int32 GetNumBodies() const;
+
+protected:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	// Per connection managers fill their batch right before they are replicated, see XRPhysicsReplicationSubsystem::ScheduleManager
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+private:
+	UPROPERTY(Replicated)
+	FXRPhysicsBodyArray Bodies;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "XRPhysicsReplicationSubsystem.generated.h"
+
+class AXRPhysicsReplicationManager;
+class APlayerController;
+class UXRReplicatedPhysicsComponent;
+class ULevel;
+
+/**
+ * Ticks all XRReplicatedPhysicsComponents that replicate through an XRPhysicsReplicationManager in one pass.
+ * Server: takes the bodies Snapshots and hands the new ones to their manager. Clients: smooth the bodies towards the Snapshots their manager received.
+ * With XRCoreSettings::bSchedulePhysicsPerConnection the server keeps one manager per remote PlayerController instead. Every body accumulates priority
+ * per connection from its distance to the players head and hands, its error since the last send and whether it is interacted with. Right before a
+ * connections manager replicates, and only once its previous batch went out, the highest priority bodies that fit the byte budget are handed to it.
+ */
+UCLASS()
+class XR_TOOLKIT_API UXRPhysicsReplicationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Start ticking the body. On the server it is added to its ReplicationManager, or the default manager of its level, which is spawned if needed.
+	 * Returns false if the body could not be registered.
+	 * NOTE: Called by XRReplicatedPhysicsComponent on BeginPlay / EndPlay.
+	 */
+	bool RegisterBody(UXRReplicatedPhysicsComponent* InBody);
+	void UnregisterBody(UXRReplicatedPhysicsComponent* InBody);
+
+	/**
+	 * [Server] Fill the next batch of a per connection manager.
+	 * NOTE: Called by XRPhysicsReplicationManager::PreReplication.
+	 */
+	void ScheduleManager(AXRPhysicsReplicationManager* InManager);
+
+	/**
+	 * Convenience accessor, returns nullptr if the World has no XRPhysicsReplicationSubsystem (iE. during teardown).
+	 */
+	static UXRPhysicsReplicationSubsystem* Get(const UObject* InWorldContextObject);
+
+private:
+	struct FRegisteredBody
+	{
+		TWeakObjectPtr<UXRReplicatedPhysicsComponent> Body;
+		// [Server]
+		TWeakObjectPtr<AXRPhysicsReplicationManager> Manager;
+		// [Server] Approximate cost of exporting the body reference (NetGUID and path) with its first send to a connection
+		int32 ReferenceExportBits = 0;
+	};
+
+	bool IsServer() const;
+	AXRPhysicsReplicationManager* FindOrSpawnLevelManager(ULevel* InLevel);
+
+	TArray<FRegisteredBody> Bodies;
+	TMap<TObjectKey<ULevel>, TWeakObjectPtr<AXRPhysicsReplicationManager>> LevelManagers;
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Per Connection Scheduler
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	struct FConnectionSchedule
+	{
+		TWeakObjectPtr<APlayerController> PlayerController;
+		TWeakObjectPtr<AXRPhysicsReplicationManager> Manager;
+		// Accumulated priority of each body, reset once its Snapshot is sent
+		TMap<TObjectKey<UXRReplicatedPhysicsComponent>, float> Priorities;
+		double LastScheduleTime = 0.0;
+	};
+
+	struct FScheduleCandidate
+	{
+		UXRReplicatedPhysicsComponent* Body = nullptr;
+		float Priority = 0.0f;
+		int32 Bits = 0;
+		bool bSent = false;
+	};
+
+	void TickScheduler(float DeltaTime);
+	void UpdateConnections();
+	void ScheduleConnection(FConnectionSchedule& InOutConnection, float InElapsedTime);
+	static void GetViewerLocations(const APlayerController* InPlayerController, TArray<FVector, TInlineAllocator<3>>& OutLocations);
+
+	TArray<FConnectionSchedule> Connections;
+	float SchedulerAccumulatedTime = 0.0f;
+
+	// Scratch buffer, reused every scheduler update
+	TArray<FScheduleCandidate> Candidates;
+};
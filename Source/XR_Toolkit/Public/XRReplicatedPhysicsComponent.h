@@ -5,23 +5,73 @@
 #include "Components/ActorComponent.h"
 #include "XRReplicatedPhysicsComponent.generated.h"
 
+class AXRPhysicsReplicationManager;
+
+
+UENUM(BlueprintType)
+enum class EXRPhysicsSmoothingMode : uint8
+{
+	Chase UMETA(DisplayName = "Chase latest Snapshot", ToolTip = "Interpolate towards the latest Snapshot with a speed derived from the replication interval."),
+	Buffered UMETA(DisplayName = "Buffered Interpolation", ToolTip = "Render RenderDelay behind the server clock, interpolating between the buffered Snapshots around that time."),
+	DeadReckoning UMETA(DisplayName = "Dead Reckoning", ToolTip = "Extrapolate the latest Snapshot with its velocities and blend out the error when a new one arrives. The server only sends once the extrapolation drifts too far."),
+};
 
 USTRUCT(BlueprintType)
 struct FXRPhysicsSnapshot
 {
 	GENERATED_BODY()
 
+	// Wrapping sequence ID, compare with IsSequenceIDNewer
 	UPROPERTY()
-	uint32 ID = 0;
+	uint16 ID = 0;
 
 	UPROPERTY(BlueprintReadWrite)
 	uint8 bIsInteractedWith = false;
 
+	// Sent once when the body comes to rest, it carries no velocities
+	UPROPERTY()
+	uint8 bIsAtRest = false;
+
+	// The body falls freely, extrapolation adds the World gravity
+	UPROPERTY()
+	uint8 bIsGravityEnabled = false;
+
 	UPROPERTY(BlueprintReadWrite)
 	FVector Location = {};
 
 	UPROPERTY(BlueprintReadWrite)
 	FRotator Rotation = {};
+
+	// cm/s, not sent for Snapshots at rest
+	UPROPERTY(BlueprintReadOnly)
+	FVector LinearVelocity = FVector::ZeroVector;
+
+	// World space, deg/s, not sent for Snapshots at rest
+	UPROPERTY(BlueprintReadOnly)
+	FVector AngularVelocity = FVector::ZeroVector;
+
+	// Server world time the Snapshot was taken at, sent with millisecond precision
+	UPROPERTY(BlueprintReadOnly)
+	double ServerTime = 0.0;
+
+	/**
+	 * Quantized replication. Location is sent with SnapshotLocationPrecision within +-SnapshotLocationBound, Rotation as a smallest-three
+	 * quaternion with SnapshotRotationBits per component, the velocities with their Snapshot*Velocity precision and bound and the flags as single bits
+	 * (see XRCoreSettings, which must match on server and clients).
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	// Bits NetSerialize writes for this Snapshot with the current XRCoreSettings
+	int32 GetNetSerializedBits() const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FXRPhysicsSnapshot> : public TStructOpsTypeTraitsBase2<FXRPhysicsSnapshot>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
 };
 
 
@@ -57,6 +107,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "XRCore|Physics Replication")
 	bool GetInteractedWith() const;
 
+	/**
+	 * True on the server. Unlike HasAuthority, also correct for Actors that do not replicate (see bUseReplicationManager), clients are authority over their own copy of those.
+	 **/
+	bool HasPhysicsAuthority() const;
+
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
 	// Colliders/Sim on Owner
 	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -104,8 +159,66 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "XRCore|Physics Replication")
 	bool bDebugDisableClientInterpolation = false;
 
+	/**
+	 * How clients move the owner between received Snapshots.
+	 **/
+	UPROPERTY(EditAnywhere, Category = "XRCore|Physics Replication")
+	EXRPhysicsSmoothingMode SmoothingMode = EXRPhysicsSmoothingMode::Buffered;
+
+	/**
+	 * Seconds clients render behind the server clock in Buffered mode. Should cover the replication interval plus the expected jitter.
+	 **/
+	UPROPERTY(EditAnywhere, Category = "XRCore|Physics Replication", meta = (ClampMin = "0.0", EditCondition = "SmoothingMode==EXRPhysicsSmoothingMode::Buffered"))
+	float RenderDelay = 0.15f;
+
+	/**
+	 * Seconds past the latest Snapshot clients keep extrapolating in DeadReckoning mode before holding the pose. Bounds the overshoot on packet loss.
+	 **/
+	UPROPERTY(EditAnywhere, Category = "XRCore|Physics Replication", meta = (ClampMin = "0.0", EditCondition = "SmoothingMode==EXRPhysicsSmoothingMode::DeadReckoning"))
+	float MaxExtrapolationTime = 0.25f;
+
+	/**
+	 * Seconds over which clients blend out the difference between the shown pose and the extrapolation of a newly received Snapshot.
+	 **/
+	UPROPERTY(EditAnywhere, Category = "XRCore|Physics Replication", meta = (ClampMin = "0.0", EditCondition = "SmoothingMode==EXRPhysicsSmoothingMode::DeadReckoning"))
+	float CorrectionBlendTime = 0.1f;
+
+	/**
+	 * Server: send a new Snapshot once the clients extrapolation is off by more than this distance, in cm.
+	 * The replication interval still caps the send rate.
+	 **/
+	UPROPERTY(EditAnywhere, Category = "XRCore|Physics Replication", meta = (ClampMin = "0.0", EditCondition = "SmoothingMode==EXRPhysicsSmoothingMode::DeadReckoning"))
+	float PositionErrorThreshold = 1.0f;
+
+	/**
+	 * Server: send a new Snapshot once the clients extrapolation is off by more than this angle, in degrees.
+	 **/
+	UPROPERTY(EditAnywhere, Category = "XRCore|Physics Replication", meta = (ClampMin = "0.0", EditCondition = "SmoothingMode==EXRPhysicsSmoothingMode::DeadReckoning"))
+	float RotationErrorThreshold = 2.0f;
+
+	/**
+	 * Replicate the Snapshots through an XRPhysicsReplicationManager instead of this components own replication, ticked together with all other managed bodies.
+	 * The owning Actor then does not need to replicate for its physics (see XRInteractionComponent::bReplicateOwner). Only works for Actors loaded with the level,
+	 * which clients can resolve without replicating them; spawned Actors keep replicating through this component, which also makes their owner replicate.
+	 **/
+	UPROPERTY(EditAnywhere, Category = "XRCore|Physics Replication")
+	bool bUseReplicationManager = false;
+
+	/**
+	 * Manager to replicate through, iE. one placed per region of a large level. Defaults to one manager per level, spawned by the server.
+	 **/
+	UPROPERTY(EditInstanceOnly, Category = "XRCore|Physics Replication", meta = (EditCondition = "bUseReplicationManager"))
+	AXRPhysicsReplicationManager* ReplicationManager = nullptr;
+
+	/**
+	 * Whether this body currently replicates through an XRPhysicsReplicationManager.
+	 **/
+	UFUNCTION(BlueprintPure, Category = "XRCore|Physics Replication")
+	bool IsUsingReplicationManager() const;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	UFUNCTION()
@@ -124,8 +237,17 @@ protected:
 	void DelayedPhysicsSetup();
 
 private:
-	UFUNCTION(Server, Reliable)
-	void Server_SetCachedSnapshot(FXRPhysicsSnapshot InCachedSnapshot);
+	friend class UXRPhysicsReplicationSubsystem;
+	friend struct FXRPhysicsBodyItem;
+
+	// Snapshot received through a XRPhysicsReplicationManager
+	void ReceiveSnapshot(const FXRPhysicsSnapshot& InSnapshot);
+	// Server: update LatestSnapshot to the current pose, only taking a single Snapshot while the body rests. Used by the per connection scheduler.
+	void CaptureSnapshot();
+	bool IsAtRest() const;
+
+	bool bRegisteredWithManager = false;
+	bool bHasReceivedSnapshot = false;
 
 	float AccumulatedTime = 0.0f;
 	float InterpolationAlpha = 0.0f;
@@ -134,19 +256,57 @@ private:
 	float DefaultReplicationInterval = 0.0f;
 	float InteractedReplicationInterval = 0.0f;
 
-	UPROPERTY(Replicated)
+	UPROPERTY(ReplicatedUsing = OnRep_LatestSnapshot)
 	FXRPhysicsSnapshot LatestSnapshot = {};
-	UPROPERTY(ReplicatedUsing = OnRep_CachedSnapshot)
-	FXRPhysicsSnapshot CachedSnapshot = {};
 
 
 	FXRPhysicsSnapshot ClientActiveSnapshot = {};
 
-	UFUNCTION()
-	bool IsSequenceIDNewer(uint32 InID1, uint32 InID2) const;
+	bool IsSequenceIDNewer(uint16 InID1, uint16 InID2) const;
 
 	UFUNCTION()
-	void OnRep_CachedSnapshot();
+	void OnRep_LatestSnapshot();
+
+	double GetServerTime() const;
+	// Snapshot of the owners current pose and velocities, following LatestSnapshot
+	FXRPhysicsSnapshot MakeSnapshot() const;
+	void ClientTickChase(float DeltaTime);
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Dead Reckoning
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Pose of the Snapshot extrapolated to InServerTime, at most MaxExtrapolationTime ahead. Shared by server and clients, so both agree on the error.
+	void ExtrapolateSnapshot(const FXRPhysicsSnapshot& InSnapshot, double InServerTime, FVector& OutLocation, FQuat& OutRotation) const;
+	void BeginCorrection();
+	void ClientTickDeadReckoning(float DeltaTime);
+
+	FVector CorrectionLocationOffset = FVector::ZeroVector;
+	FQuat CorrectionRotationOffset = FQuat::Identity;
+	double CorrectionStartTime = 0.0;
+
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	// Snapshot Buffer
+	// ------------------------------------------------------------------------------------------------------------------------------------------------------------
+	struct FBufferedSnapshot
+	{
+		double ServerTime = 0.0;
+		FVector Location = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+		FVector LinearVelocity = FVector::ZeroVector;
+		bool bIsAtRest = false;
+	};
+	static constexpr int32 SnapshotBufferCapacity = 16;
+
+	void BufferSnapshot(const FXRPhysicsSnapshot& InSnapshot);
+	// Drop the oldest Snapshots
+	void DiscardBufferedSnapshots(int32 InCount);
+	// 0 is the oldest buffered Snapshot
+	const FBufferedSnapshot& GetBufferedSnapshot(int32 InIndex) const;
+	void ClientTickBuffered(float DeltaTime);
+
+	FBufferedSnapshot SnapshotBuffer[SnapshotBufferCapacity];
+	int32 SnapshotBufferHead = 0;
+	int32 SnapshotBufferCount = 0;
 
 	UPROPERTY()
 	TArray<UMeshComponent*> RegisteredMeshComponents = {};
@@ -50,8 +50,26 @@ public:
 	 * @InPrioritySelectionCondition Determine whether only exactly matching priorities should be returned.
 	 */
 	UFUNCTION(BlueprintPure, Category = "XRCore|Utilities")
-	static UXRInteractionComponent* GetXRInteractionByPriority(TArray<UXRInteractionComponent*> InInteractions, UXRInteractorComponent* InXRInteractor = nullptr, int32 InPriority = 0, 
-		EXRInteractionPrioritySelection InPrioritySelectionCondition = EXRInteractionPrioritySelection::LowerEqual, int32 MaxSecondaryPriority = 5);
+	static UXRInteractionComponent* GetXRInteractionByPriority(const TArray<UXRInteractionComponent*>& InInteractions, UXRInteractorComponent* InXRInteractor = nullptr, int32 InPriority = 0, 
+		EXRInteractionPrioritySelection InPrioritySelectionCondition = EXRInteractionPrioritySelection::LowerEqual);
+
+	/**
+	 * Native version of GetXRInteractionByPriority. Selects the Interaction in a single pass over InInteractions without allocating.
+	 * Ties between Interactions with the same Priority are resolved by their order in InInteractions.
+	 */
+	static UXRInteractionComponent* GetXRInteractionByPriority(TArrayView<UXRInteractionComponent* const> InInteractions, UXRInteractorComponent* InXRInteractor = nullptr, int32 InPriority = 0, 
+		EXRInteractionPrioritySelection InPrioritySelectionCondition = EXRInteractionPrioritySelection::LowerEqual);
+
+	/**
+	 * Returns true if the Interaction may currently be selected (by the XRInteractor, if provided): active, allowed for Lasers and not blocked by its MultiInteractor behavior.
+	 */
+	static bool IsXRInteractionSelectable(const UXRInteractionComponent* InInteraction, const UXRInteractorComponent* InXRInteractor = nullptr);
+
+	/**
+	 * Returns true for the project defined channels (Project Settings > Collision), false for the engine channels (WorldStatic, WorldDynamic, Pawn, ...),
+	 * which most objects in a level respond to.
+	 */
+	static bool IsProjectCollisionChannel(ECollisionChannel InChannel);
 
 	/**
 	 * Returns true if this Actor has an XRInteractorComponent
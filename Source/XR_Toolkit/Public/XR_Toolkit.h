@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Engine/StreamableManager.h"
+
+XR_TOOLKIT_API DECLARE_LOG_CATEGORY_EXTERN(LogXRToolkit, Log, All);
 
 class FXR_ToolkitModule : public IModuleInterface
 {
@@ -12,4 +15,29 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	static FXR_ToolkitModule& Get();
+
+	/**
+	 * Handle of the async preload of the XRCoreSettings default assets (sounds, highlight curve, hologram class).
+	 * Invalid until the engine finished initializing or if no defaults are configured.
+	 */
+	TSharedPtr<FStreamableHandle> GetDefaultAssetsHandle() const;
+
+	bool AreDefaultAssetsLoaded() const;
+
+	/**
+	 * Execute the delegate once the default assets are loaded, right away if they already are.
+	 */
+	void CallWhenDefaultAssetsLoaded(FSimpleDelegate InDelegate);
+
+private:
+	void PreloadDefaultAssets();
+	void OnDefaultAssetsLoaded();
+
+	FStreamableManager StreamableManager;
+	TSharedPtr<FStreamableHandle> DefaultAssetsHandle;
+	FSimpleMulticastDelegate DefaultAssetsLoadedDelegate;
+	FDelegateHandle PostEngineInitHandle;
+	bool bDefaultAssetsLoaded = false;
 };
@@ -27,6 +27,7 @@ public class XR_Toolkit : ModuleRules
 			{
 				"Core", 
 				"InputCore",
+				"NetCore",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);